@@ -0,0 +1,43 @@
+#include "Animatronic.hpp"
+#include "../systems/RoomGraph.hpp"
+
+namespace Engine {
+
+Room chooseStep(MoveContext& context, std::uint32_t agent) {
+    AgentData& agents = context.agents;
+    Room room = agents.room[agent];
+    Room target = agents.target[agent];
+    const RoomGraph& graph = context.graph;
+
+    std::size_t count = graph.neighbourCount(room);
+    if (count == 0) {
+        return room;
+    }
+    const Room* neighbours = graph.neighboursBegin(room);
+
+    // Two times in three, pick among the neighbours that get closer
+    if (nextRandom(agents.rng[agent], 3) != 0) {
+        Room closer[ROOM_COUNT];
+        std::size_t closerCount = 0;
+        std::uint8_t current = graph.distance(room, target);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (graph.distance(neighbours[i], target) < current) {
+                closer[closerCount++] = neighbours[i];
+            }
+        }
+        if (closerCount > 0) {
+            return closer[nextRandom(agents.rng[agent], static_cast<std::uint32_t>(closerCount))];
+        }
+    }
+    return neighbours[nextRandom(agents.rng[agent], static_cast<std::uint32_t>(count))];
+}
+
+void resolveDoor(MoveContext& context, std::uint32_t agent, bool doorClosed, Room retreat) {
+    if (doorClosed) {
+        moveAgent(context, agent, retreat, AIEventType::Blocked);
+    } else {
+        moveAgent(context, agent, Room::Office, AIEventType::Attack);
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Locations in the building. Camera IDs from the monitor map in comments.
+enum class Room : std::uint8_t {
+    ShowStage,        // 1A
+    DiningArea,       // 1B
+    PirateCove,       // 1C
+    WestHall,         // 2A
+    WestHallCorner,   // 2B
+    SupplyCloset,     // 3
+    EastHall,         // 4A
+    EastHallCorner,   // 4B
+    Backstage,        // 5
+    Kitchen,          // 6 (audio only)
+    Restrooms,        // 7
+    WestDoor,         // Outside the left office door
+    EastDoor,         // Outside the right office door
+    Office,
+    Count
+};
+
+constexpr std::size_t ROOM_COUNT = static_cast<std::size_t>(Room::Count);
+
+constexpr std::uint32_t roomBit(Room room) {
+    return 1u << static_cast<std::uint32_t>(room);
+}
+
+enum class AnimatronicKind : std::uint8_t {
+    Freddy,
+    Bonnie,
+    Chica,
+    Foxy,
+    Count
+};
+
+constexpr std::size_t ANIMATRONIC_KIND_COUNT = static_cast<std::size_t>(AnimatronicKind::Count);
+
+// What the AI reacts to, written by the gameplay side once per frame
+struct AIWorldState {
+    bool leftDoorClosed = false;
+    bool rightDoorClosed = false;
+    bool cameraUp = false;
+    Room watchedRoom = Room::Count;   // Camera feed on screen, Count when none
+};
+
+enum class AIEventType : std::uint8_t {
+    Moved,      // from -> to
+    Blocked,    // A closed door turned it away (Foxy's bang drains power)
+    Attack      // Reached the office
+};
+
+struct AIEvent {
+    AIEventType type;
+    AnimatronicKind kind;
+    std::uint32_t agent;
+    Room from;
+    Room to;
+};
+
+// Animatronic state as parallel arrays, one entry per agent. The tick walks
+// each array linearly instead of chasing per-object pointers.
+struct AgentData {
+    std::vector<AnimatronicKind> kind;
+    std::vector<Room> room;
+    std::vector<std::uint8_t> aiLevel;        // 0-20
+    std::vector<float> movementTimer;         // Seconds until the next movement opportunity
+    std::vector<Room> target;                 // Door the agent is working towards
+    std::vector<std::uint8_t> phase;          // Per-character step (Freddy's path index, Foxy's stage)
+    std::vector<std::uint32_t> rng;           // xorshift32 state
+
+    std::size_t size() const { return kind.size(); }
+};
+
+// Uniform integer in [0, bound) from an agent's xorshift32 state
+inline std::uint32_t nextRandom(std::uint32_t& state, std::uint32_t bound) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<std::uint32_t>((static_cast<std::uint64_t>(state) * bound) >> 32);
+}
+
+class RoomGraph;
+
+// Everything a behaviour may touch while resolving its agents' moves
+struct MoveContext {
+    AgentData& agents;
+    const RoomGraph& graph;       // Restricted to the character's rooms
+    const AIWorldState& world;
+    std::vector<AIEvent>& events;
+};
+
+// Resolves a batch of agents of one kind that passed their movement roll
+using MoveBatchFn = void (*)(MoveContext& context, const std::uint32_t* agents, std::size_t count);
+
+// Strategy table entry. AIManager calls `move` once per kind per tick with
+// every agent of that kind whose opportunity succeeded.
+struct Behaviour {
+    const char* name;
+    float moveInterval;       // Seconds between movement opportunities
+    Room startRoom;
+    Room target;
+    std::uint32_t roomMask;   // Rooms the character may walk through
+    MoveBatchFn move;
+};
+
+// Shared helper for behaviours: moves an agent and records the event
+inline void moveAgent(MoveContext& context, std::uint32_t agent, Room to, AIEventType type = AIEventType::Moved) {
+    Room from = context.agents.room[agent];
+    context.agents.room[agent] = to;
+    context.events.push_back({ type, context.agents.kind[agent], agent, from, to });
+}
+
+// Next room for a wandering character: usually a hop closer to its target,
+// sometimes any neighbour so it does not walk a straight line
+Room chooseStep(MoveContext& context, std::uint32_t agent);
+
+// At a door: attack if it is open, otherwise fall back to `retreat`
+void resolveDoor(MoveContext& context, std::uint32_t agent, bool doorClosed, Room retreat);
+
+} // namespace Engine
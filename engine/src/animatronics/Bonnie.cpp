@@ -0,0 +1,40 @@
+#include "Bonnie.hpp"
+
+namespace Engine {
+
+namespace Bonnie {
+
+void move(MoveContext& context, const std::uint32_t* agents, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t agent = agents[i];
+        Room room = context.agents.room[agent];
+        if (room == Room::Office) {
+            continue;
+        }
+        if (room == Room::WestDoor) {
+            resolveDoor(context, agent, context.world.leftDoorClosed, Room::DiningArea);
+            continue;
+        }
+        Room next = chooseStep(context, agent);
+        if (next != room) {
+            moveAgent(context, agent, next);
+        }
+    }
+}
+
+Behaviour behaviour() {
+    return {
+        "Bonnie",
+        MOVE_INTERVAL,
+        Room::ShowStage,
+        Room::WestDoor,
+        roomBit(Room::ShowStage) | roomBit(Room::DiningArea) | roomBit(Room::Backstage) |
+            roomBit(Room::WestHall) | roomBit(Room::SupplyCloset) | roomBit(Room::WestHallCorner) |
+            roomBit(Room::WestDoor),
+        &move
+    };
+}
+
+} // namespace Bonnie
+
+} // namespace Engine
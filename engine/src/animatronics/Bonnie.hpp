@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Animatronic.hpp"
+
+namespace Engine {
+
+// Wanders the west side, ignoring the cameras. Jumps between rooms rather
+// than following a fixed path, and tries the left door.
+namespace Bonnie {
+    constexpr float MOVE_INTERVAL = 4.97f;
+
+    void move(MoveContext& context, const std::uint32_t* agents, std::size_t count);
+    Behaviour behaviour();
+}
+
+} // namespace Engine
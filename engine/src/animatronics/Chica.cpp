@@ -0,0 +1,40 @@
+#include "Chica.hpp"
+
+namespace Engine {
+
+namespace Chica {
+
+void move(MoveContext& context, const std::uint32_t* agents, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t agent = agents[i];
+        Room room = context.agents.room[agent];
+        if (room == Room::Office) {
+            continue;
+        }
+        if (room == Room::EastDoor) {
+            resolveDoor(context, agent, context.world.rightDoorClosed, Room::DiningArea);
+            continue;
+        }
+        Room next = chooseStep(context, agent);
+        if (next != room) {
+            moveAgent(context, agent, next);
+        }
+    }
+}
+
+Behaviour behaviour() {
+    return {
+        "Chica",
+        MOVE_INTERVAL,
+        Room::ShowStage,
+        Room::EastDoor,
+        roomBit(Room::ShowStage) | roomBit(Room::DiningArea) | roomBit(Room::Restrooms) |
+            roomBit(Room::Kitchen) | roomBit(Room::EastHall) | roomBit(Room::EastHallCorner) |
+            roomBit(Room::EastDoor),
+        &move
+    };
+}
+
+} // namespace Chica
+
+} // namespace Engine
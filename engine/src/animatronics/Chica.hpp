@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Animatronic.hpp"
+
+namespace Engine {
+
+// Roams the east side through the kitchen and restrooms, ignoring the
+// cameras, and tries the right door.
+namespace Chica {
+    constexpr float MOVE_INTERVAL = 4.98f;
+
+    void move(MoveContext& context, const std::uint32_t* agents, std::size_t count);
+    Behaviour behaviour();
+}
+
+} // namespace Engine
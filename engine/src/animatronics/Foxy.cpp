@@ -0,0 +1,56 @@
+#include "Foxy.hpp"
+
+namespace Engine {
+
+namespace Foxy {
+
+void move(MoveContext& context, const std::uint32_t* agents, std::size_t count) {
+    AgentData& data = context.agents;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t agent = agents[i];
+        switch (data.room[agent]) {
+            case Room::PirateCove:
+                // Watching any camera keeps him behind the curtain
+                if (context.world.cameraUp) {
+                    break;
+                }
+                if (data.phase[agent] < READY_STAGE) {
+                    ++data.phase[agent];
+                } else {
+                    moveAgent(context, agent, Room::WestHall);
+                }
+                break;
+
+            case Room::WestHall:
+                moveAgent(context, agent, Room::WestDoor);
+                break;
+
+            case Room::WestDoor:
+                if (context.world.leftDoorClosed) {
+                    data.phase[agent] = static_cast<std::uint8_t>(nextRandom(data.rng[agent], 2));
+                    moveAgent(context, agent, Room::PirateCove, AIEventType::Blocked);
+                } else {
+                    moveAgent(context, agent, Room::Office, AIEventType::Attack);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+Behaviour behaviour() {
+    return {
+        "Foxy",
+        MOVE_INTERVAL,
+        Room::PirateCove,
+        Room::WestDoor,
+        roomBit(Room::PirateCove) | roomBit(Room::WestHall) | roomBit(Room::WestDoor),
+        &move
+    };
+}
+
+} // namespace Foxy
+
+} // namespace Engine
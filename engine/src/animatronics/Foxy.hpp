@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Animatronic.hpp"
+
+namespace Engine {
+
+// Builds up behind the Pirate Cove curtain while nobody has the monitor up,
+// then leaves for the west hall and sprints at the left door. A closed door
+// sends him back to the cove (the bang costs power, see AIEventType::Blocked).
+namespace Foxy {
+    constexpr float MOVE_INTERVAL = 5.01f;
+    constexpr std::uint8_t READY_STAGE = 3;   // Curtain stages before he leaves the cove
+
+    void move(MoveContext& context, const std::uint32_t* agents, std::size_t count);
+    Behaviour behaviour();
+}
+
+} // namespace Engine
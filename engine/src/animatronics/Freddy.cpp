@@ -0,0 +1,61 @@
+#include "Freddy.hpp"
+
+namespace Engine {
+
+namespace Freddy {
+
+namespace {
+    constexpr Room ROUTE[] = {
+        Room::ShowStage,
+        Room::DiningArea,
+        Room::Restrooms,
+        Room::Kitchen,
+        Room::EastHall,
+        Room::EastHallCorner,
+        Room::EastDoor
+    };
+    constexpr std::uint8_t ROUTE_LENGTH = sizeof(ROUTE) / sizeof(ROUTE[0]);
+}
+
+void move(MoveContext& context, const std::uint32_t* agents, std::size_t count) {
+    AgentData& data = context.agents;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t agent = agents[i];
+        Room room = data.room[agent];
+        if (room == Room::Office) {
+            continue;
+        }
+        if (context.world.cameraUp && context.world.watchedRoom == room) {
+            continue;
+        }
+
+        std::uint8_t step = data.phase[agent];
+        if (step + 1 < ROUTE_LENGTH) {
+            data.phase[agent] = static_cast<std::uint8_t>(step + 1);
+            moveAgent(context, agent, ROUTE[step + 1]);
+        } else if (context.world.rightDoorClosed) {
+            // Shut out: back down the hall
+            data.phase[agent] = static_cast<std::uint8_t>(ROUTE_LENGTH - 3);
+            moveAgent(context, agent, ROUTE[ROUTE_LENGTH - 3], AIEventType::Blocked);
+        } else if (context.world.cameraUp) {
+            moveAgent(context, agent, Room::Office, AIEventType::Attack);
+        }
+    }
+}
+
+Behaviour behaviour() {
+    return {
+        "Freddy",
+        MOVE_INTERVAL,
+        ROUTE[0],
+        Room::EastDoor,
+        roomBit(Room::ShowStage) | roomBit(Room::DiningArea) | roomBit(Room::Restrooms) |
+            roomBit(Room::Kitchen) | roomBit(Room::EastHall) | roomBit(Room::EastHallCorner) |
+            roomBit(Room::EastDoor),
+        &move
+    };
+}
+
+} // namespace Freddy
+
+} // namespace Engine
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Animatronic.hpp"
+
+namespace Engine {
+
+// Follows a fixed route down the east side and cannot move while the camera
+// is on him. Only enters through an open right door while the monitor is up.
+namespace Freddy {
+    constexpr float MOVE_INTERVAL = 3.02f;
+
+    void move(MoveContext& context, const std::uint32_t* agents, std::size_t count);
+    Behaviour behaviour();
+}
+
+} // namespace Engine
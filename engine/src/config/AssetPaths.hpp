@@ -1,7 +1,6 @@
 #pragma once
 
 #include <string>
-#include <filesystem>
 #include <iostream>
 #include <unistd.h>
 #include <linux/limits.h>
@@ -20,34 +19,9 @@ namespace AssetPaths {
             }
             return "";
         }
-
-        // Internal helper to resolve paths at runtime
-        inline std::string resolvePath(const std::string& path) {
-            std::string exeDir = getExecutableDir();
-            
-            // First try relative to executable
-            std::string exePath = exeDir + "/" + path;
-            if (std::filesystem::exists(exePath)) {
-                return exePath;
-            }
-            
-            // Then try relative to current directory
-            if (std::filesystem::exists(path)) {
-                return path;
-            }
-            
-            // If not found, try the development path
-            std::string devPath = "engine/" + path;
-            if (std::filesystem::exists(devPath)) {
-                return devPath;
-            }
-            
-            // Return the exe path as default (error will be handled by the loading function)
-            return exePath;
-        }
     }
 
-    // Base paths
+    // Base paths (logical, resolved by Engine::VirtualFileSystem)
     const std::string ASSETS_DIR = "assets";
     const std::string TEXTURES_DIR = ASSETS_DIR + "/textures";
     const std::string FONTS_DIR = ASSETS_DIR + "/fonts";
@@ -59,34 +33,37 @@ namespace AssetPaths {
     const std::string UI_SFX_DIR = SFX_DIR + "/ui";
     
     // Music files
-    const std::string MENU_MUSIC_START = resolvePath(MUSIC_DIR + "/menu-music-start.ogg");
-    const std::string MENU_MUSIC_LOOP = resolvePath(MUSIC_DIR + "/menu-music-loop.ogg");
+    const std::string MENU_MUSIC_START = MUSIC_DIR + "/menu-music-start.ogg";
+    const std::string MENU_MUSIC_LOOP = MUSIC_DIR + "/menu-music-loop.ogg";
     
     // Sound files
-    const std::string MENU_HOVER_SOUND = resolvePath(UI_SFX_DIR + "/menu-hover.ogg");
+    const std::string MENU_HOVER_SOUND = UI_SFX_DIR + "/menu-hover.ogg";
     
     // Animation paths
     const std::string ANIMATIONS_DIR = TEXTURES_DIR + "/animations";
-    const std::string MAIN_MENU_ANIM = resolvePath(ANIMATIONS_DIR + "/main-menu-anim");
-    const std::string OPTIONS_ENTER_ANIM = resolvePath(ANIMATIONS_DIR + "/options-enter");
-    const std::string OPTIONS_EXIT_ANIM = resolvePath(ANIMATIONS_DIR + "/options-exit");
+    const std::string MAIN_MENU_ANIM = ANIMATIONS_DIR + "/main-menu-anim";
+    const std::string OPTIONS_ENTER_ANIM = ANIMATIONS_DIR + "/options-enter";
+    const std::string OPTIONS_EXIT_ANIM = ANIMATIONS_DIR + "/options-exit";
     
+    // Camera feed backgrounds, cam-<label>.jpg
+    const std::string CAMERAS_DIR = TEXTURES_DIR + "/cameras";
+
     // UI paths
     const std::string UI_DIR = TEXTURES_DIR + "/ui";
-    const std::string WARNING_TEXTURE = resolvePath(UI_DIR + "/warning.jpg");
-    const std::string MENU_TEXT_TEXTURE = resolvePath(UI_DIR + "/menu-text.png");
-    const std::string OPTIONS_BUTTONS_TEXTURE = resolvePath(UI_DIR + "/options-buttons.png");
-    const std::string RESET_ALL_PROGRESS_TEXTURE = resolvePath(UI_DIR + "/reset-game-button.png");
+    const std::string WARNING_TEXTURE = UI_DIR + "/warning.jpg";
+    const std::string MENU_TEXT_TEXTURE = UI_DIR + "/menu-text.png";
+    const std::string OPTIONS_BUTTONS_TEXTURE = UI_DIR + "/options-buttons.png";
+    const std::string RESET_ALL_PROGRESS_TEXTURE = UI_DIR + "/reset-game-button.png";
     // Font paths
-    const std::string DEJAVU_SANS = resolvePath(FONTS_DIR + "/DejaVuSans.ttf");
-    const std::string OCRAEXT = resolvePath(FONTS_DIR + "/OCRAEXT.ttf");
+    const std::string DEJAVU_SANS = FONTS_DIR + "/DejaVuSans.ttf";
+    const std::string OCRAEXT = FONTS_DIR + "/OCRAEXT.ttf";
     
     // UI Elements
-    inline const std::string UI_CHECK = resolvePath(UI_DIR + "/check.jpg");
-    inline const std::string UI_SELECTOR = resolvePath(UI_DIR + "/selector.png");
-    // inline const std::string UI_VOLUME_LINE = resolvePath(UI_DIR + "/volume-line.png");
-    inline const std::string MENU_CONFIG = resolvePath(ASSETS_DIR + "/config/menu_config.json");
+    inline const std::string UI_CHECK = UI_DIR + "/check.jpg";
+    inline const std::string UI_SELECTOR = UI_DIR + "/selector.png";
+    // inline const std::string UI_VOLUME_LINE = UI_DIR + "/volume-line.png";
+    inline const std::string MENU_CONFIG = ASSETS_DIR + "/config/menu_config.json";
 
     // Audio config
-    inline const std::string AUDIO_CONFIG = resolvePath(ASSETS_DIR + "/config/audio_config.json");
+    inline const std::string AUDIO_CONFIG = ASSETS_DIR + "/config/audio_config.json";
 } 
\ No newline at end of file
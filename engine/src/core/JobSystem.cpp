@@ -0,0 +1,156 @@
+#include "JobSystem.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Engine {
+
+JobSystem& JobSystem::getInstance() {
+    static JobSystem instance(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return instance;
+}
+
+JobSystem::JobSystem(unsigned int workerCount)
+    : waiters(0)
+    , stopping(false)
+{
+    workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this);
+    }
+    TSS_LOG_DEBUG("JobSystem", "Started", field("workers", workerCount));
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void JobSystem::submit(JobCounter& counter, Job job) {
+    counter.remaining.fetch_add(1, std::memory_order_relaxed);
+    if (workers.empty()) {
+        // Nobody else would pick it up
+        QueuedJob queued{ std::move(job), &counter };
+        execute(queued);
+        return;
+    }
+    bool wakeWaiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back({ std::move(job), &counter });
+        wakeWaiters = waiters > 0;
+    }
+    available.notify_one();
+    if (wakeWaiters) {
+        progress.notify_all();
+    }
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    while (!counter.isDone()) {
+        if (runOne()) {
+            continue;
+        }
+        // Our remaining jobs are running on other threads
+        std::unique_lock<std::mutex> lock(mutex);
+        ++waiters;
+        progress.wait(lock, [this, &counter] { return counter.isDone() || !queue.empty(); });
+        --waiters;
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::exchange(counter.error, nullptr);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void JobSystem::parallelFor(std::size_t count, std::size_t grain,
+                            const std::function<void(std::size_t, std::size_t)>& body) {
+    grain = std::max<std::size_t>(1, grain);
+    if (count <= grain || workers.empty()) {
+        if (count > 0) {
+            body(0, count);
+        }
+        return;
+    }
+
+    JobCounter counter;
+    for (std::size_t begin = grain; begin < count; begin += grain) {
+        std::size_t end = std::min(count, begin + grain);
+        submit(counter, [&body, begin, end] { body(begin, end); });
+    }
+    // First range on this thread while the workers start on the rest. The
+    // other ranges reference `body`, so they are joined even if it throws.
+    std::exception_ptr error;
+    try {
+        body(0, grain);
+    } catch (...) {
+        error = std::current_exception();
+    }
+    wait(counter);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+bool JobSystem::runOne() {
+    QueuedJob queued;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        queued = std::move(queue.front());
+        queue.pop_front();
+    }
+    execute(queued);
+    return true;
+}
+
+void JobSystem::execute(QueuedJob& queued) {
+    JobCounter& counter = *queued.counter;
+    try {
+        queued.job();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!counter.error) {
+            counter.error = std::current_exception();
+        }
+    }
+
+    // The waiter may destroy the counter as soon as it reaches zero
+    if (counter.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (waiters > 0) {
+            progress.notify_all();
+        }
+    }
+}
+
+void JobSystem::workerLoop() {
+    for (;;) {
+        QueuedJob queued;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping && queue.empty()) {
+                return;
+            }
+            queued = std::move(queue.front());
+            queue.pop_front();
+        }
+        execute(queued);
+    }
+}
+
+} // namespace Engine
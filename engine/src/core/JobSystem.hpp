@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+// Counts the unfinished jobs of one group; wait() on it to join the group
+class JobCounter {
+public:
+    bool isDone() const { return remaining.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<std::size_t> remaining{ 0 };
+    std::exception_ptr error;     // First exception of the group; guarded by the JobSystem mutex
+};
+
+// Worker pool fed from one job queue. A thread waiting on a counter runs
+// queued jobs itself and only blocks once the queue is empty, so jobs can
+// submit and wait on further jobs (a parallel loop inside a parallel phase)
+// without deadlocking, and the calling thread is never idle while work is
+// left. An exception thrown by a job is kept and rethrown by wait().
+//
+// getInstance() sizes the pool to the machine: one worker per core besides
+// the main thread. With no workers everything runs on the waiting thread.
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    static JobSystem& getInstance();
+
+    explicit JobSystem(unsigned int workerCount);
+    ~JobSystem();
+
+    void submit(JobCounter& counter, Job job);
+
+    // Returns once every job submitted against `counter` has finished,
+    // running queued jobs in the meantime. Rethrows the first exception one
+    // of them threw.
+    void wait(JobCounter& counter);
+
+    // Calls body(begin, end) over [0, count) in ranges of `grain` and waits
+    void parallelFor(std::size_t count, std::size_t grain,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    unsigned int getWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+private:
+    struct QueuedJob {
+        Job job;
+        JobCounter* counter = nullptr;
+    };
+
+    void workerLoop();
+    bool runOne();
+    void execute(QueuedJob& queued);
+
+    std::vector<std::thread> workers;
+    std::deque<QueuedJob> queue;
+    std::mutex mutex;
+    std::condition_variable available;
+    std::condition_variable progress;    // A job finished its group, or a job was queued
+    std::size_t waiters;                 // Threads blocked in wait()
+    bool stopping;
+};
+
+} // namespace Engine
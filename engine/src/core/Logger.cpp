@@ -0,0 +1,245 @@
+#include "Logger.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+namespace {
+    const char* levelName(LogLevel level) {
+        switch (level) {
+            case LogLevel::Trace: return "TRACE";
+            case LogLevel::Debug: return "DEBUG";
+            case LogLevel::Info:  return "INFO ";
+            case LogLevel::Warn:  return "WARN ";
+            case LogLevel::Error: return "ERROR";
+            default:              return "     ";
+        }
+    }
+
+    LogLevel parseLevel(const char* text, LogLevel fallback) {
+        if (!text) return fallback;
+        std::string name(text);
+        if (name == "trace") return LogLevel::Trace;
+        if (name == "debug") return LogLevel::Debug;
+        if (name == "info") return LogLevel::Info;
+        if (name == "warn") return LogLevel::Warn;
+        if (name == "error") return LogLevel::Error;
+        if (name == "off") return LogLevel::Off;
+        return fallback;
+    }
+
+    // Idle wait of the writer thread when the ring is empty
+    constexpr auto IDLE_SLEEP = std::chrono::milliseconds(4);
+
+    std::mutex synchronousMutex;
+}
+
+void LogLine::append(std::string_view value) {
+    std::size_t count = std::min(value.size(), CAPACITY - length);
+    std::memcpy(text + length, value.data(), count);
+    length += count;
+}
+
+void LogLine::appendSigned(long long value) {
+    auto result = std::to_chars(text + length, text + CAPACITY, value);
+    if (result.ec == std::errc()) length = static_cast<std::size_t>(result.ptr - text);
+}
+
+void LogLine::appendUnsigned(unsigned long long value) {
+    auto result = std::to_chars(text + length, text + CAPACITY, value);
+    if (result.ec == std::errc()) length = static_cast<std::size_t>(result.ptr - text);
+}
+
+void LogLine::appendFloat(double value) {
+    char buffer[32];
+    int count = std::snprintf(buffer, sizeof(buffer), "%.4g", value);
+    if (count > 0) append(std::string_view(buffer, static_cast<std::size_t>(count)));
+}
+
+void LogLine::appendText(std::string_view value) {
+    if (value.find(' ') == std::string_view::npos && !value.empty()) {
+        append(value);
+        return;
+    }
+    append("\"");
+    append(value);
+    append("\"");
+}
+
+void LogLine::appendPointer(const void* value) {
+    char buffer[24];
+    int count = std::snprintf(buffer, sizeof(buffer), "%p", value);
+    if (count > 0) append(std::string_view(buffer, static_cast<std::size_t>(count)));
+}
+
+Logger::Logger()
+    : cells(std::make_unique<Cell[]>(RING_CAPACITY))
+    , enqueuePosition(0)
+    , dequeuePosition(0)
+    , writtenCount(0)
+    , droppedCount(0)
+    , runtimeLevel(static_cast<int>(parseLevel(std::getenv("TSS_LOG"), LogLevel::Info)))
+    , running(true)
+    , synchronous(false)
+    , startTime(0)
+{
+    for (std::size_t i = 0; i < RING_CAPACITY; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    startTime = now();
+    worker = std::thread(&Logger::run, this);
+
+    // Drain before exit; anything logged later is written synchronously
+    std::atexit([] { getInstance().shutdown(); });
+}
+
+Logger& Logger::getInstance() {
+    static Logger* instance = new Logger();
+    return *instance;
+}
+
+std::uint64_t Logger::now() const {
+    auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) - startTime;
+}
+
+void Logger::submit(LogLevel level, const char* category, const LogLine& line) {
+    if (synchronous.load(std::memory_order_acquire)) {
+        Record record;
+        record.timestampUs = now();
+        record.category = category;
+        record.level = level;
+        record.length = static_cast<std::uint16_t>(line.size());
+        std::memcpy(record.text, line.data(), line.size());
+        std::lock_guard<std::mutex> lock(synchronousMutex);
+        writeRecords(&record, 1);
+        return;
+    }
+
+    // Bounded MPSC queue: claim a cell by advancing enqueuePosition, fill it,
+    // then publish it by bumping its sequence
+    std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+        cell = &cells[position & (RING_CAPACITY - 1)];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record& record = cell->record;
+    record.timestampUs = now();
+    record.category = category;
+    record.level = level;
+    record.length = static_cast<std::uint16_t>(line.size());
+    std::memcpy(record.text, line.data(), line.size());
+    cell->sequence.store(position + 1, std::memory_order_release);
+}
+
+bool Logger::tryPop(Record& record) {
+    Cell& cell = cells[dequeuePosition & (RING_CAPACITY - 1)];
+    std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    if (sequence != dequeuePosition + 1) {
+        return false;
+    }
+    record = cell.record;
+    cell.sequence.store(dequeuePosition + RING_CAPACITY, std::memory_order_release);
+    ++dequeuePosition;
+    return true;
+}
+
+void Logger::run() {
+    std::vector<Record> batch(64);
+    for (;;) {
+        std::size_t count = 0;
+        while (count < batch.size() && tryPop(batch[count])) {
+            ++count;
+        }
+
+        if (count > 0) {
+            writeRecords(batch.data(), count);
+            writtenCount.fetch_add(count, std::memory_order_release);
+            continue;
+        }
+
+        if (!running.load(std::memory_order_acquire)) {
+            break;
+        }
+        std::this_thread::sleep_for(IDLE_SLEEP);
+    }
+}
+
+void Logger::writeRecords(const Record* records, std::size_t count) {
+    // One write per stream per batch
+    std::string out;
+    std::string errors;
+    out.reserve(count * 96);
+
+    std::size_t dropped = droppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        errors += "[logger] dropped " + std::to_string(dropped) + " lines (ring full)\n";
+    }
+
+    char prefix[64];
+    for (std::size_t i = 0; i < count; ++i) {
+        const Record& record = records[i];
+        int length = std::snprintf(prefix, sizeof(prefix), "[%9.3f] %s %s: ",
+                                   static_cast<double>(record.timestampUs) / 1e6,
+                                   levelName(record.level), record.category);
+        std::string& target = record.level >= LogLevel::Warn ? errors : out;
+        target.append(prefix, static_cast<std::size_t>(std::max(length, 0)));
+        target.append(record.text, record.length);
+        target += '\n';
+    }
+
+    if (!out.empty()) {
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        std::fflush(stdout);
+    }
+    if (!errors.empty()) {
+        std::fwrite(errors.data(), 1, errors.size(), stderr);
+    }
+}
+
+void Logger::flush() {
+    if (synchronous.load(std::memory_order_acquire)) {
+        return;
+    }
+    // Everything claimed so far has been written once the count catches up
+    std::size_t target = enqueuePosition.load(std::memory_order_acquire);
+    while (writtenCount.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void Logger::shutdown() {
+    running.store(false, std::memory_order_release);
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    // Producers racing with shutdown may still have published lines
+    Record record;
+    while (tryPop(record)) {
+        writeRecords(&record, 1);
+    }
+    synchronous.store(true, std::memory_order_release);
+}
+
+} // namespace Engine
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+// Lowest level that is compiled in. Calls below it are discarded by
+// `if constexpr`, arguments included. Override with -DTSS_LOG_LEVEL=<0..5>.
+#ifndef TSS_LOG_LEVEL
+#ifdef NDEBUG
+#define TSS_LOG_LEVEL 2   // Info
+#else
+#define TSS_LOG_LEVEL 0   // Trace
+#endif
+#endif
+
+namespace Engine {
+
+enum class LogLevel : int {
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+};
+
+// key=value pair appended after the message. Holds a reference, so it must
+// be consumed within the logging statement (which the macros guarantee).
+template <typename T>
+struct LogField {
+    const char* key;
+    const T& value;
+};
+
+template <typename T>
+LogField<T> field(const char* key, const T& value) {
+    return LogField<T>{ key, value };
+}
+
+// Fixed-size line formatted on the calling thread without allocating.
+// Anything past CAPACITY is cut off.
+class LogLine {
+public:
+    static constexpr std::size_t CAPACITY = 232;
+
+    void append(std::string_view text);
+
+    template <typename T>
+    void appendValue(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            append(value ? "true" : "false");
+        } else if constexpr (std::is_enum_v<T>) {
+            appendSigned(static_cast<long long>(value));
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            appendSigned(value);
+        } else if constexpr (std::is_integral_v<T>) {
+            appendUnsigned(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            appendFloat(static_cast<double>(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            appendText(value);
+        } else if constexpr (std::is_pointer_v<T>) {
+            appendPointer(value);
+        } else {
+            static_assert(sizeof(T) == 0, "Unsupported log field type");
+        }
+    }
+
+    template <typename T>
+    void appendField(const LogField<T>& item) {
+        append(" ");
+        append(item.key);
+        append("=");
+        appendValue(item.value);
+    }
+
+    const char* data() const { return text; }
+    std::size_t size() const { return length; }
+
+private:
+    void appendSigned(long long value);
+    void appendUnsigned(unsigned long long value);
+    void appendFloat(double value);
+    void appendText(std::string_view value);   // Quoted if it contains spaces
+    void appendPointer(const void* value);
+
+    char text[CAPACITY];
+    std::size_t length = 0;
+};
+
+// Leveled logger. Callers format into a LogLine and push it onto a bounded
+// lock-free MPSC ring; a background thread drains the ring and writes whole
+// batches to stdout (Warn and above to stderr), so the game thread never
+// flushes or takes a lock. If the ring is full the line is dropped and
+// counted rather than blocking.
+//
+// Use the TSS_LOG_* macros:
+//   TSS_LOG_INFO("Animation", "Found frames", Engine::field("count", n));
+//
+// The runtime level defaults to Info and can be set with TSS_LOG=trace|
+// debug|info|warn|error|off or setLevel(). Levels below TSS_LOG_LEVEL are not
+// compiled at all.
+class Logger {
+public:
+    static Logger& getInstance();
+
+    static bool isEnabled(LogLevel level) {
+        return static_cast<int>(level) >= getInstance().runtimeLevel.load(std::memory_order_relaxed);
+    }
+
+    void setLevel(LogLevel level) { runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed); }
+
+    template <typename... Fields>
+    void write(LogLevel level, const char* category, std::string_view message, const LogField<Fields>&... fields) {
+        LogLine line;
+        line.append(message);
+        (line.appendField(fields), ...);
+        submit(level, category, line);
+    }
+
+    // Blocks until everything logged so far has been written
+    void flush();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+private:
+    Logger();
+    ~Logger() = delete;   // Lives until exit so static destructors can still log
+
+    static constexpr std::size_t RING_CAPACITY = 1024;   // Power of two
+
+    struct Record {
+        std::uint64_t timestampUs;
+        const char* category;     // String literal
+        LogLevel level;
+        std::uint16_t length;
+        char text[LogLine::CAPACITY];
+    };
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        Record record;
+    };
+
+    void submit(LogLevel level, const char* category, const LogLine& line);
+    bool tryPop(Record& record);
+    void run();
+    void shutdown();
+    void writeRecords(const Record* records, std::size_t count);
+    std::uint64_t now() const;
+
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<std::size_t> enqueuePosition;
+    alignas(64) std::size_t dequeuePosition;
+    std::atomic<std::size_t> writtenCount;
+    std::atomic<std::size_t> droppedCount;
+
+    std::atomic<int> runtimeLevel;
+    std::atomic<bool> running;
+    std::atomic<bool> synchronous;   // After shutdown lines are written directly
+    std::thread worker;
+    std::uint64_t startTime;
+};
+
+} // namespace Engine
+
+#define TSS_LOG(level, category, ...)                                                   \
+    do {                                                                                \
+        if constexpr (static_cast<int>(level) >= TSS_LOG_LEVEL) {                       \
+            if (::Engine::Logger::isEnabled(level)) {                                   \
+                ::Engine::Logger::getInstance().write(level, category, __VA_ARGS__);    \
+            }                                                                           \
+        }                                                                               \
+    } while (0)
+
+#define TSS_LOG_TRACE(category, ...) TSS_LOG(::Engine::LogLevel::Trace, category, __VA_ARGS__)
+#define TSS_LOG_DEBUG(category, ...) TSS_LOG(::Engine::LogLevel::Debug, category, __VA_ARGS__)
+#define TSS_LOG_INFO(category, ...) TSS_LOG(::Engine::LogLevel::Info, category, __VA_ARGS__)
+#define TSS_LOG_WARN(category, ...) TSS_LOG(::Engine::LogLevel::Warn, category, __VA_ARGS__)
+#define TSS_LOG_ERROR(category, ...) TSS_LOG(::Engine::LogLevel::Error, category, __VA_ARGS__)
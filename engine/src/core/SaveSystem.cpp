@@ -0,0 +1,229 @@
+#include "SaveSystem.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Engine {
+
+namespace {
+    // Anything bigger is not one of our saves
+    constexpr std::size_t MAX_SAVE_SIZE = 64 * 1024;
+
+    const std::array<std::uint32_t, 256> CRC_TABLE = [] {
+        std::array<std::uint32_t, 256> table{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                value = (value & 1) ? (value >> 1) ^ 0xEDB88320u : value >> 1;
+            }
+            table[i] = value;
+        }
+        return table;
+    }();
+
+    bool writeAll(int fd, const char* bytes, std::size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, bytes, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            bytes += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+}
+
+std::uint32_t SaveFormat::crc32(const void* data, std::size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = CRC_TABLE[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+SaveSystem& SaveSystem::getInstance() {
+    static SaveSystem instance;
+    return instance;
+}
+
+SaveSystem::SaveSystem()
+    : path(defaultPath())
+    , hasQueued(false)
+    , writing(false)
+    , stopping(false)
+{
+    writer = std::thread(&SaveSystem::writerLoop, this);
+}
+
+SaveSystem::~SaveSystem() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+}
+
+std::string SaveSystem::defaultPath() {
+    // $XDG_DATA_HOME/they-still-sing, falling back to ~/.local/share
+    std::filesystem::path dir;
+    if (const char* dataHome = std::getenv("XDG_DATA_HOME"); dataHome && *dataHome) {
+        dir = dataHome;
+    } else if (const char* home = std::getenv("HOME"); home && *home) {
+        dir = std::filesystem::path(home) / ".local" / "share";
+    } else {
+        return SaveFormat::FILE_NAME;
+    }
+    dir /= "they-still-sing";
+
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    if (error) {
+        std::cerr << "SaveSystem: Cannot create " << dir << ", saving to the working directory" << std::endl;
+        return SaveFormat::FILE_NAME;
+    }
+    return (dir / SaveFormat::FILE_NAME).string();
+}
+
+bool SaveSystem::load() {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        TSS_LOG_INFO("SaveSystem", "No save, starting fresh", field("path", path));
+        return false;
+    }
+
+    struct stat info;
+    std::vector<char> bytes;
+    bool readOk = ::fstat(fd, &info) == 0 &&
+                  static_cast<std::size_t>(info.st_size) >= sizeof(SaveFormat::Header) &&
+                  static_cast<std::size_t>(info.st_size) <= MAX_SAVE_SIZE;
+    if (readOk) {
+        bytes.resize(static_cast<std::size_t>(info.st_size));
+        readOk = ::read(fd, bytes.data(), bytes.size()) == static_cast<ssize_t>(bytes.size());
+    }
+    ::close(fd);
+    if (!readOk) {
+        std::cerr << "SaveSystem: Failed to read save: " << path << std::endl;
+        return false;
+    }
+
+    SaveFormat::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    const char* payload = bytes.data() + sizeof(header);
+    if (std::memcmp(header.magic, SaveFormat::MAGIC, sizeof(SaveFormat::MAGIC)) != 0 ||
+        header.version == 0 || header.version > SaveFormat::VERSION ||
+        header.payloadSize != bytes.size() - sizeof(header)) {
+        std::cerr << "SaveSystem: Unsupported save format: " << path << std::endl;
+        return false;
+    }
+    if (SaveFormat::crc32(payload, header.payloadSize) != header.checksum) {
+        std::cerr << "SaveSystem: Save checksum mismatch: " << path << std::endl;
+        return false;
+    }
+
+    // Older saves are shorter; the fields they lack keep their defaults
+    SaveData loaded;
+    std::memcpy(&loaded, payload, std::min<std::size_t>(header.payloadSize, sizeof(SaveData)));
+    data = loaded;
+
+    TSS_LOG_INFO("SaveSystem", "Loaded save", field("version", header.version),
+                 field("night", data.night));
+    return true;
+}
+
+void SaveSystem::save() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued = data;
+        hasQueued = true;
+    }
+    wake.notify_one();
+}
+
+void SaveSystem::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !hasQueued && !writing; });
+}
+
+void SaveSystem::resetProgress() {
+    SaveData fresh;
+    fresh.copySettings(data);
+    data = fresh;
+}
+
+void SaveSystem::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || hasQueued; });
+        if (!hasQueued) {
+            return;
+        }
+
+        SaveData snapshot = queued;
+        hasQueued = false;
+        writing = true;
+        lock.unlock();
+
+        writeFile(snapshot);
+
+        lock.lock();
+        writing = false;
+        if (!hasQueued) {
+            idle.notify_all();
+        }
+    }
+}
+
+bool SaveSystem::writeFile(const SaveData& snapshot) const {
+    SaveFormat::Header header{};
+    std::memcpy(header.magic, SaveFormat::MAGIC, sizeof(SaveFormat::MAGIC));
+    header.version = SaveFormat::VERSION;
+    header.payloadSize = sizeof(SaveData);
+    header.checksum = SaveFormat::crc32(&snapshot, sizeof(SaveData));
+
+    char buffer[sizeof(SaveFormat::Header) + sizeof(SaveData)];
+    std::memcpy(buffer, &header, sizeof(header));
+    std::memcpy(buffer + sizeof(header), &snapshot, sizeof(SaveData));
+
+    // Temp file + fsync + rename: readers see the old save or the new one
+    std::string tempPath = path + ".tmp";
+    int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "SaveSystem: Failed to create " << tempPath << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    bool ok = writeAll(fd, buffer, sizeof(buffer)) && ::fsync(fd) == 0;
+    ok = ::close(fd) == 0 && ok;
+    if (!ok || std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::cerr << "SaveSystem: Failed to write " << path << ": " << std::strerror(errno) << std::endl;
+        ::unlink(tempPath.c_str());
+        return false;
+    }
+
+    // Persist the rename itself
+    std::string dir = std::filesystem::path(path).parent_path().string();
+    int dirFd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (dirFd >= 0) {
+        ::fsync(dirFd);
+        ::close(dirFd);
+    }
+
+    TSS_LOG_DEBUG("SaveSystem", "Saved", field("path", path), field("night", snapshot.night));
+    return true;
+}
+
+} // namespace Engine
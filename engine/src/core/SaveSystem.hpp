@@ -0,0 +1,125 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace Engine {
+
+// Everything that persists between runs. Stored verbatim as the save
+// payload, so fields are only ever appended: an older save is loaded over
+// the defaults and simply lacks the newer fields. Bump SaveFormat::VERSION
+// whenever a field is added.
+struct SaveData {
+    // Progress
+    std::uint32_t night = 1;              // Night CONTINUE starts
+    std::uint32_t highestNight = 0;       // Best night survived
+
+    // Settings (kept by copySettings)
+    float sfxVolume = 100.0f;
+    float musicVolume = 100.0f;
+    std::uint8_t fullscreen = 0;
+    std::uint8_t reserved[3] = {};
+
+    // Stats
+    std::uint32_t nightsPlayed = 0;
+    std::uint32_t nightsSurvived = 0;
+    std::uint32_t powerOuts = 0;
+    std::uint32_t deaths[4] = {};         // Indexed by AnimatronicKind
+    double playTime = 0.0;                // Seconds spent in nights
+
+    // Settings (version 2, kept by copySettings)
+    float renderScale = 0.0f;             // Internal render scale; 0 = dynamic
+    std::uint32_t reserved2 = 0;
+
+    // Every setting above; a progress reset keeps these, so new settings
+    // belong here too
+    void copySettings(const SaveData& from) {
+        sfxVolume = from.sfxVolume;
+        musicVolume = from.musicVolume;
+        fullscreen = from.fullscreen;
+        renderScale = from.renderScale;
+    }
+};
+
+static_assert(std::is_trivially_copyable<SaveData>::value, "SaveData is written as raw bytes");
+static_assert(sizeof(SaveData) == 64, "SaveData layout changed; bump SaveFormat::VERSION");
+
+// On-disk layout of save.dat (little-endian): Header | SaveData bytes.
+// The checksum is the CRC-32 of the payload.
+namespace SaveFormat {
+
+constexpr char MAGIC[8] = {'T', 'S', 'S', 'S', 'A', 'V', 'E', '\0'};
+constexpr std::uint32_t VERSION = 2;
+constexpr const char* FILE_NAME = "save.dat";
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t payloadSize;
+    std::uint32_t checksum;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 24, "SaveFormat::Header layout changed");
+
+std::uint32_t crc32(const void* data, std::size_t size);
+
+} // namespace SaveFormat
+
+// Loads the save once at startup with a single read and writes it back on
+// a background thread. save() copies the data and returns at once; the
+// writer coalesces requests, so only the newest copy is written. A write
+// goes to a temporary file that is fsynced and renamed over the save, so a
+// crash mid-write leaves the previous save intact.
+class SaveSystem {
+public:
+    static SaveSystem& getInstance();
+
+    // Keeps the defaults and returns false when there is no valid save
+    bool load();
+
+    const SaveData& get() const { return data; }
+    SaveData& edit() { return data; }
+
+    // Queues the current data for the writer thread
+    void save();
+
+    // Blocks until every queued save is on disk
+    void flush();
+
+    // Back to night 1 with no stats; settings are kept
+    void resetProgress();
+
+    const std::string& getPath() const { return path; }
+
+    SaveSystem(const SaveSystem&) = delete;
+    SaveSystem& operator=(const SaveSystem&) = delete;
+
+private:
+    SaveSystem();
+    ~SaveSystem();
+
+    static std::string defaultPath();
+    bool writeFile(const SaveData& snapshot) const;
+    void writerLoop();
+
+    std::string path;
+    SaveData data;
+
+    // Shared with the writer thread
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    SaveData queued;
+    bool hasQueued;
+    bool writing;
+    bool stopping;
+    std::thread writer;
+};
+
+} // namespace Engine
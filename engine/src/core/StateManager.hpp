@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../states/GameState.hpp"
+#include <cstdint>
 #include <memory>
 
 class StateManager {
@@ -12,9 +13,13 @@ public:
     
     void changeState(std::unique_ptr<GameState> newState) {
         currentState = std::move(newState);
+        ++generation;
     }
     
     GameState* getCurrentState() { return currentState.get(); }
+
+    // Incremented on every state change
+    std::uint64_t getGeneration() const { return generation; }
     
 private:
     StateManager() = default;
@@ -24,4 +29,5 @@ private:
     StateManager& operator=(const StateManager&) = delete;
     
     std::unique_ptr<GameState> currentState;
+    std::uint64_t generation = 0;
 };
@@ -0,0 +1,211 @@
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace Engine {
+
+namespace {
+    // Tolerance for seconds -> ticks conversions of accumulated doubles
+    constexpr double TICK_EPSILON = 1e-6;
+}
+
+TimerWheel::TimerWheel()
+    : occupied(0)
+    , currentTick(0)
+    , elapsed(0.0)
+    , pending(0)
+{
+    slots.fill(NONE);
+}
+
+TimerWheel& TimerWheel::getInstance() {
+    static TimerWheel instance;
+    return instance;
+}
+
+std::uint64_t TimerWheel::toTicks(double seconds) {
+    // Never due in the current tick, which may already be firing. The
+    // epsilon keeps 0.029 s from rounding up to 30 ticks.
+    double ticks = std::ceil(std::max(0.0, seconds) * TICKS_PER_SECOND - TICK_EPSILON);
+    return std::max<std::uint64_t>(1, static_cast<std::uint64_t>(ticks));
+}
+
+TimerHandle TimerWheel::schedule(double delaySeconds, Callback callback) {
+    return insertNew(toTicks(delaySeconds), 0, std::move(callback));
+}
+
+TimerHandle TimerWheel::scheduleRepeating(double intervalSeconds, Callback callback) {
+    std::uint64_t interval = toTicks(intervalSeconds);
+    return insertNew(interval, interval, std::move(callback));
+}
+
+TimerHandle TimerWheel::insertNew(std::uint64_t delayTicks, std::uint64_t interval, Callback callback) {
+    std::uint32_t index;
+    if (!freeTimers.empty()) {
+        index = freeTimers.back();
+        freeTimers.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(timers.size());
+        timers.emplace_back();
+    }
+
+    Timer& timer = timers[index];
+    timer.callback = std::move(callback);
+    timer.expiry = currentTick + delayTicks;
+    timer.interval = interval;
+    timer.cancelled = false;
+    file(index);
+    ++pending;
+    return TimerHandle{ index, timer.generation };
+}
+
+void TimerWheel::file(std::uint32_t index) {
+    Timer& timer = timers[index];
+    std::uint64_t delta = timer.expiry - currentTick;
+
+    // Coarsest level whose slot still lands before the expiry; anything past
+    // the last level's range waits there and is re-filed on cascade
+    std::uint32_t level = 0;
+    while (level + 1 < LEVELS && delta >= (std::uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+    std::uint64_t when = timer.expiry;
+    std::uint64_t range = std::uint64_t(1) << (SLOT_BITS * LEVELS);
+    if (delta >= range) {
+        when = currentTick + range - 1;
+    }
+    auto slot = static_cast<std::int32_t>(level * SLOTS + ((when >> (SLOT_BITS * level)) & (SLOTS - 1)));
+
+    timer.slot = slot;
+    timer.prev = NONE;
+    timer.next = slots[slot];
+    if (timer.next != NONE) {
+        timers[timer.next].prev = static_cast<std::int32_t>(index);
+    }
+    slots[slot] = static_cast<std::int32_t>(index);
+    if (slot < static_cast<std::int32_t>(SLOTS)) {
+        occupied |= std::uint64_t(1) << slot;
+    }
+}
+
+void TimerWheel::unlink(std::uint32_t index) {
+    Timer& timer = timers[index];
+    if (timer.prev != NONE) {
+        timers[timer.prev].next = timer.next;
+    } else {
+        slots[timer.slot] = timer.next;
+        if (timer.next == NONE && timer.slot < static_cast<std::int32_t>(SLOTS)) {
+            occupied &= ~(std::uint64_t(1) << timer.slot);
+        }
+    }
+    if (timer.next != NONE) {
+        timers[timer.next].prev = timer.prev;
+    }
+    timer.prev = NONE;
+    timer.next = NONE;
+    timer.slot = NONE;
+}
+
+void TimerWheel::release(std::uint32_t index) {
+    Timer& timer = timers[index];
+    timer.callback = nullptr;
+    timer.slot = NONE;
+    ++timer.generation;
+    freeTimers.push_back(index);
+    --pending;
+}
+
+bool TimerWheel::isPending(const TimerHandle& handle) const {
+    if (handle.index >= timers.size()) {
+        return false;
+    }
+    const Timer& timer = timers[handle.index];
+    return timer.generation == handle.generation && timer.slot != NONE && !timer.cancelled;
+}
+
+bool TimerWheel::cancel(TimerHandle& handle) {
+    bool wasPending = isPending(handle);
+    if (wasPending) {
+        Timer& timer = timers[handle.index];
+        if (timer.slot == FIRING) {
+            // Released by tick() once the callback returns
+            timer.cancelled = true;
+        } else {
+            unlink(handle.index);
+            release(handle.index);
+        }
+    }
+    handle = TimerHandle();
+    return wasPending;
+}
+
+void TimerWheel::cascade(std::uint32_t level) {
+    auto slot = level * SLOTS + ((currentTick >> (SLOT_BITS * level)) & (SLOTS - 1));
+    std::int32_t index = slots[slot];
+    slots[slot] = NONE;
+    while (index != NONE) {
+        std::int32_t next = timers[index].next;
+        file(static_cast<std::uint32_t>(index));
+        index = next;
+    }
+}
+
+void TimerWheel::tick() {
+    ++currentTick;
+
+    // Pull the next block of each coarser level down when the finer one wraps
+    for (std::uint32_t level = 1; level < LEVELS; ++level) {
+        if ((currentTick & ((std::uint64_t(1) << (SLOT_BITS * level)) - 1)) != 0) {
+            break;
+        }
+        cascade(level);
+    }
+
+    auto slot = static_cast<std::size_t>(currentTick & (SLOTS - 1));
+    while (slots[slot] != NONE) {
+        auto index = static_cast<std::uint32_t>(slots[slot]);
+        unlink(index);
+        timers[index].slot = FIRING;
+
+        // The pool may grow inside the callback, so no references across it
+        Callback callback = std::move(timers[index].callback);
+        callback();
+
+        Timer& timer = timers[index];
+        if (timer.interval > 0 && !timer.cancelled) {
+            timer.callback = std::move(callback);
+            timer.expiry += timer.interval;
+            file(index);
+        } else {
+            release(index);
+        }
+    }
+}
+
+void TimerWheel::advance(double deltaSeconds) {
+    elapsed += std::max(0.0, deltaSeconds);
+    auto target = static_cast<std::uint64_t>(elapsed * TICKS_PER_SECOND + TICK_EPSILON);
+    if (pending == 0) {
+        // Nothing to fire; the empty wheel can jump
+        currentTick = std::max(currentTick, target);
+        return;
+    }
+    while (currentTick < target) {
+        // Jump over empty level-0 slots, but never past the end of the
+        // current block: the tick that wraps it has to cascade
+        std::uint64_t limit = std::min(target, currentTick | (SLOTS - 1));
+        if (limit > currentTick) {
+            std::uint64_t span = limit - currentTick;
+            std::uint64_t ahead = occupied >> ((currentTick + 1) & (SLOTS - 1));
+            std::uint64_t window = span >= SLOTS ? ~std::uint64_t(0) : (std::uint64_t(1) << span) - 1;
+            if ((ahead & window) == 0) {
+                currentTick = limit;
+                continue;
+            }
+        }
+        tick();
+    }
+}
+
+} // namespace Engine
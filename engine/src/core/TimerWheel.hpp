@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Engine {
+
+// Identifies a scheduled timer. Default constructed = no timer; stays safe
+// to cancel after the timer fired or was cancelled.
+struct TimerHandle {
+    std::uint32_t index = UINT32_MAX;
+    std::uint32_t generation = 0;
+
+    bool isSet() const { return index != UINT32_MAX; }
+};
+
+// Hierarchical timing wheel: four levels of 64 slots at 1 ms resolution,
+// covering about 4.6 hours before timers are re-filed. Scheduling and
+// cancelling are O(1) (a list insert/unlink); advancing skips runs of
+// empty ticks using a bitmask of occupied slots and only stops on ticks
+// that fire something or cascade from a coarser level.
+//
+// Timers live in a pool and are addressed by generation-checked handles, so
+// cancelling a timer that already fired is harmless. Callbacks may schedule
+// or cancel timers, including their own. Not thread-safe: a wheel belongs
+// to the thread that advances it.
+//
+// getInstance() is the main-loop wheel, advanced once per frame by main();
+// simulations own their own wheels.
+class TimerWheel {
+public:
+    using Callback = std::function<void()>;
+
+    static constexpr std::uint32_t TICKS_PER_SECOND = 1000;
+
+    static TimerWheel& getInstance();
+
+    TimerWheel();
+
+    TimerHandle schedule(double delaySeconds, Callback callback);
+    TimerHandle scheduleRepeating(double intervalSeconds, Callback callback);
+
+    // Returns false if the timer was not pending; clears the handle
+    bool cancel(TimerHandle& handle);
+    bool isPending(const TimerHandle& handle) const;
+
+    // Fires everything due within the next `deltaSeconds`
+    void advance(double deltaSeconds);
+
+    // Seconds advanced since construction
+    double getTime() const { return elapsed; }
+    std::size_t getPendingCount() const { return pending; }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+private:
+    static constexpr std::uint32_t LEVELS = 4;
+    static constexpr std::uint32_t SLOT_BITS = 6;
+    static constexpr std::uint32_t SLOTS = 1u << SLOT_BITS;
+    static constexpr std::int32_t NONE = -1;
+    static constexpr std::int32_t FIRING = -2;
+
+    struct Timer {
+        Callback callback;
+        std::uint64_t expiry = 0;
+        std::uint64_t interval = 0;   // Ticks, 0 for one-shot
+        std::uint32_t generation = 0;
+        std::int32_t prev = NONE;
+        std::int32_t next = NONE;
+        std::int32_t slot = NONE;     // Index into `slots`, NONE when free, FIRING in a callback
+        bool cancelled = false;
+    };
+
+    TimerHandle insertNew(std::uint64_t delayTicks, std::uint64_t interval, Callback callback);
+    void file(std::uint32_t index);
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);
+    void cascade(std::uint32_t level);
+    void tick();
+    static std::uint64_t toTicks(double seconds);
+
+    std::vector<Timer> timers;
+    std::vector<std::uint32_t> freeTimers;
+    std::array<std::int32_t, LEVELS * SLOTS> slots;
+    std::uint64_t occupied;       // Bit per non-empty level-0 slot
+    std::uint64_t currentTick;
+    double elapsed;
+    std::size_t pending;
+};
+
+} // namespace Engine
@@ -1,17 +1,48 @@
 #include <SFML/Graphics.hpp>
-#include <sstream>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <stdexcept>
 #include <memory>
 #include "states/WarningState.hpp"
+#include "states/GameplayState.hpp"
+#include "core/SaveSystem.hpp"
 #include "core/StateManager.hpp"
+#include "core/TimerWheel.hpp"
 #include "config/AssetPaths.hpp"
 #include "ui/MenuManager.hpp"
+#include "systems/animation/AnimationManager.hpp"
+#include "systems/animation/FrameStore.hpp"
+#include "systems/ui/CachedText.hpp"
 #include "systems/ui/ScalingManager.hpp"
 #include "systems/audio_systems/AudioSystem.hpp"
+#include "systems/render/RenderQueue.hpp"
+#include "systems/render/RenderScaler.hpp"
 
 const unsigned int BASE_WIDTH = 1280;
 const unsigned int BASE_HEIGHT = 720;
+const float FRAME_TIME = 1.0f / 30.0f;
+
+// Unfocused, the game ticks at 4 FPS; audio is still polled at the normal
+// rate so music changes over on time
+const float BACKGROUND_FRAME_TIME = 1.0f / 4.0f;
+const std::size_t DEFAULT_BACKGROUND_FRAMES = 2;  // Frames each animation keeps
+const float MAX_REFILL_TIME = 0.5f;               // Give up waiting for the refill
+
+// Frames kept per animation in the background (TSS_BACKGROUND_FRAMES)
+std::size_t backgroundFrameFloor() {
+    const char* value = std::getenv("TSS_BACKGROUND_FRAMES");
+    if (!value || !*value) {
+        return DEFAULT_BACKGROUND_FRAMES;
+    }
+    char* end = nullptr;
+    unsigned long frames = std::strtoul(value, &end, 10);
+    return *end == '\0' ? static_cast<std::size_t>(frames) : DEFAULT_BACKGROUND_FRAMES;
+}
+
+// R cycles through these; 0 is dynamic
+const float RENDER_SCALES[] = { 0.0f, 1.0f, 0.75f, 0.5f };
 
 void updateView(sf::RenderWindow& window) {
     // Update ScalingManager with new window size
@@ -22,27 +53,45 @@ void updateView(sf::RenderWindow& window) {
     view.setSize(window.getSize().x, window.getSize().y);
     view.setCenter(window.getSize().x / 2.0f, window.getSize().y / 2.0f);
     window.setView(view);
+
+    // Resized or recreated: whatever was on screen is gone
+    Engine::RenderQueue::getInstance().invalidate();
 }
 
 int main() {
     try {
+        // Progress and settings, one read
+        auto& saves = Engine::SaveSystem::getInstance();
+        saves.load();
+        
         // Create a window with 1280x720 resolution
-        sf::RenderWindow window(sf::VideoMode(BASE_WIDTH, BASE_HEIGHT), "They Still Sing", sf::Style::Default | sf::Style::Resize);
-        bool isFullscreen = false;
+        bool isFullscreen = saves.get().fullscreen != 0;
+        sf::RenderWindow window;
+        if (isFullscreen) {
+            window.create(sf::VideoMode::getDesktopMode(), "They Still Sing", sf::Style::Fullscreen);
+        } else {
+            window.create(sf::VideoMode(BASE_WIDTH, BASE_HEIGHT), "They Still Sing", sf::Style::Default | sf::Style::Resize);
+        }
         bool showHitboxes = false;
         
-        // Initialize ScalingManager with base window size
-        Engine::ScalingManager::getInstance().updateWindowSize(BASE_WIDTH, BASE_HEIGHT);
+        // Initialize ScalingManager and the view with the actual window size
+        updateView(window);
+        auto& renderScaler = Engine::RenderScaler::getInstance();
+        renderScaler.setFixedScale(saves.get().renderScale);
         
         // Initialize AudioSystem
         auto& audio = Engine::AudioSystem::getInstance();
         audio.initialize(AssetPaths::AUDIO_CONFIG);
         audio.setDebugEnabled(false);  // Disable debug output
+        audio.setCategoryVolume("sfx", saves.get().sfxVolume);
+        audio.setCategoryVolume("music", saves.get().musicVolume);
         
-        // Set up menu music transition callback
+        // Set up menu music transition callback. A night stops the intro
+        // early; the loop then starts when the night returns to the menu.
         bool menuLoopStarted = false;
         audio.setMusicStopCallback([&audio, &menuLoopStarted](const std::string& musicName) {
-            if (musicName == "menu-start" && !menuLoopStarted) {
+            bool inNight = dynamic_cast<GameplayState*>(StateManager::getInstance().getCurrentState()) != nullptr;
+            if (musicName == "menu-start" && !menuLoopStarted && !inNight) {
                 audio.playMusic("menu-loop");
                 menuLoopStarted = true;
             }
@@ -51,20 +100,14 @@ int main() {
         // Start menu intro music
         audio.playMusic("menu-start");
         
-        // Set frame limit to 30 FPS
-        window.setFramerateLimit(30);
-
         // Load font from embedded assets
-        sf::Font font;
-        if (!font.loadFromFile(AssetPaths::OCRAEXT)) {
+        if (!Engine::GlyphAtlas::get(AssetPaths::OCRAEXT, 20)) {
             throw std::runtime_error("Failed to load OCRAEXT font");
         }
 
-        // Create FPS text
-        sf::Text fpsText;
-        fpsText.setFont(font);
-        fpsText.setCharacterSize(30);
-        fpsText.setFillColor(sf::Color::White);
+        // Create FPS text, at its absolute position from menu_config.json
+        Engine::CachedText fpsText(AssetPaths::OCRAEXT, 20.0f);
+        fpsText.setPosition(Engine::ScalingManager::absoluteToNormalized(1137.0f, 20.0f));
 
         // Initialize state manager with warning state
         StateManager::getInstance().changeState(std::make_unique<WarningState>());
@@ -74,6 +117,16 @@ int main() {
         
         // Clock for FPS calculation
         sf::Clock fpsClock;
+
+        // Background run mode: low tick rate, animation caches released
+        const std::size_t backgroundFrames = backgroundFrameFloor();
+        bool focused = true;
+        bool refilling = false;
+        sf::Clock refillClock;
+
+        // What the frame on screen was drawn with, for damage tracking
+        std::uint64_t presentedGeneration = 0;
+        std::uint64_t presentedEpoch = 0;
         
         // Main game loop
         while (window.isOpen()) {
@@ -82,6 +135,21 @@ int main() {
                 if (event.type == sf::Event::Closed) {
                     window.close();
                 }
+                else if (event.type == sf::Event::LostFocus) {
+                    focused = false;
+                    refilling = false;
+                    AnimationManager::getInstance().suspend(backgroundFrames);
+                }
+                else if (event.type == sf::Event::GainedFocus) {
+                    // Stay at the background rate until the frames ahead of
+                    // each playhead are decoded again
+                    focused = true;
+                    refilling = true;
+                    refillClock.restart();
+                    AnimationManager::getInstance().resume();
+                    // The compositor may not have kept the last frame
+                    Engine::RenderQueue::getInstance().invalidate();
+                }
                 else if (event.type == sf::Event::KeyPressed) {
                     switch (event.key.code) {
                         case sf::Keyboard::Escape:
@@ -94,29 +162,44 @@ int main() {
                             } else {
                                 window.create(sf::VideoMode(BASE_WIDTH, BASE_HEIGHT), "They Still Sing", sf::Style::Default | sf::Style::Resize);
                             }
-                            window.setFramerateLimit(30);
                             updateView(window);
+                            saves.edit().fullscreen = isFullscreen ? 1 : 0;
+                            saves.save();
                             break;
                         case sf::Keyboard::D:
                             showHitboxes = !showHitboxes;
                             MenuManager::getInstance().toggleDebugMode();
                             break;
+                        case sf::Keyboard::R: {
+                            // Next render scale after the current setting
+                            float current = renderScaler.isDynamic() ? 0.0f : renderScaler.getScale();
+                            const std::size_t count = sizeof(RENDER_SCALES) / sizeof(RENDER_SCALES[0]);
+                            std::size_t next = 0;
+                            for (std::size_t i = 0; i < count; ++i) {
+                                if (RENDER_SCALES[i] == current) {
+                                    next = (i + 1) % count;
+                                }
+                            }
+                            renderScaler.setFixedScale(RENDER_SCALES[next]);
+                            saves.edit().renderScale = RENDER_SCALES[next];
+                            saves.save();
+                            break;
+                        }
                         default:
                             break;
                     }
                 }
                 else if (event.type == sf::Event::Resized) {
                     updateView(window);
-                    // Scale FPS text size using ScalingManager
-                    fpsText.setCharacterSize(static_cast<unsigned int>(
-                        Engine::ScalingManager::getInstance().getScaledFontSize(20.0f)
-                    ));
                 }
             }
             
             // Calculate delta time
             float deltaTime = deltaClock.restart().asSeconds();
             
+            // Fire timers that came due this frame
+            Engine::TimerWheel::getInstance().advance(deltaTime);
+            
             // Update audio system
             audio.update(deltaTime);
 
@@ -140,20 +223,8 @@ int main() {
                 fpsAccum = 0.0f;
             }
 
-            // Clear the window
-            window.clear();
-
-            // Update FPS text
-            std::stringstream ss;
-            ss << "FPS: " << displayFps;
-            fpsText.setString(ss.str());
-            
-            // Convert absolute coordinates from menu_config.json to normalized coordinates
-            sf::Vector2f normalizedPos = Engine::ScalingManager::absoluteToNormalized(1137.0f, 20.0f);
-            sf::Vector2f fpsPos = Engine::ScalingManager::getInstance().convertNormalizedToScreen(
-                normalizedPos.x, normalizedPos.y, Engine::Anchor::TopLeft
-            );
-            fpsText.setPosition(fpsPos);
+            // Update FPS text (rebuilt only when the number changes)
+            fpsText.setNumber("FPS: ", displayFps);
             
             // Update and draw current state
             auto& stateManager = StateManager::getInstance();
@@ -163,19 +234,72 @@ int main() {
             if (auto* state = stateManager.getCurrentState()) {
                 state->update(deltaTime);
             }
-            if (auto* state = stateManager.getCurrentState()) {
-                state->draw(window);
+            sf::RenderTarget& target = renderScaler.beginFrame(window);
+            auto* state = stateManager.getCurrentState();
+            if (state) {
+                state->draw(target);
+            }
+            // FPS counter on top
+            fpsText.submit(Engine::RenderLayer::Debug);
+
+            // Damage tracking: a static state that queued the same quads as
+            // the frame on screen leaves the window as it is
+            auto& renderQueue = Engine::RenderQueue::getInstance();
+            std::uint64_t epoch = Engine::ScalingManager::getInstance().getEpoch();
+            if (stateManager.getGeneration() != presentedGeneration || epoch != presentedEpoch) {
+                renderQueue.invalidate();
+            }
+            if (state && state->isStatic() && renderQueue.isUnchanged()) {
+                renderQueue.discard();
+            } else {
+                // Clear and submit everything the state queued this frame
+                renderQueue.flush(target);
+                renderScaler.present(window);
+                window.display();
+
+                presentedGeneration = stateManager.getGeneration();
+                presentedEpoch = epoch;
+
+                // The work time drives the dynamic render scale; skipped
+                // frames say nothing about it
+                renderScaler.recordFrameTime(deltaClock.getElapsedTime().asSeconds(), FRAME_TIME);
+            }
+
+            // Frame limiter: the work time is measured separately from the
+            // wait, so this replaces setFramerateLimit
+            if (refilling && (!AnimationManager::getInstance().isRefilling() ||
+                              refillClock.getElapsedTime().asSeconds() > MAX_REFILL_TIME)) {
+                refilling = false;
+            }
+            const bool background = !focused || refilling;
+            const float frameTime = background ? BACKGROUND_FRAME_TIME : FRAME_TIME;
+            float elapsed = deltaClock.getElapsedTime().asSeconds();
+            while (elapsed < frameTime) {
+                if (!background) {
+                    sf::sleep(sf::seconds(frameTime - elapsed));
+                    break;
+                }
+                // Background: wake at the normal rate for audio, and resume
+                // as soon as the refill is done
+                sf::sleep(sf::seconds(std::min(FRAME_TIME, frameTime - elapsed)));
+                audio.update(FRAME_TIME);
+                if (refilling && !AnimationManager::getInstance().isRefilling()) {
+                    refilling = false;
+                    break;
+                }
+                elapsed = deltaClock.getElapsedTime().asSeconds();
             }
-            
-            // Draw FPS counter on top
-            window.draw(fpsText);
-            window.display();
         }
 
         // Stop all music before closing
         audio.stopMusic("menu-start");
         audio.stopMusic("menu-loop");
         
+        // Let the save thread finish before exiting
+        saves.flush();
+        
+        FrameStore::getInstance().logReport();
+        
     } catch (const std::exception& e) {
         std::cerr << "Fatal error: " << e.what() << std::endl;
         return 1;
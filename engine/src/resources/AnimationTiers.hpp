@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+namespace Engine {
+
+// Downscaled copies of every animation, generated by AssetPacker next to
+// the full-size frames:
+//
+//   assets/textures/animations/main-menu-anim/0001.jpg        1280x720
+//   assets/textures/animations/main-menu-anim/tier2/0001.jpg  640x360
+//   assets/textures/animations/main-menu-anim/tier4/0001.jpg  320x180
+//
+// A tier holds the same file names as its animation, at 1/denominator of
+// the size (rounded up, like a DCT-scaled decode). Smaller windows decode
+// a smaller file instead of scaling a full-size one in the IDCT, which
+// still has to entropy-decode every coefficient. Loose asset directories
+// have no tiers; animations then fall back to DCT scaling alone.
+namespace AnimationTiers {
+
+constexpr const char* ANIMATIONS_PREFIX = "assets/textures/animations/";
+constexpr unsigned int DENOMINATORS[] = { 2, 4 };
+constexpr int JPEG_QUALITY = 90;
+
+inline std::string directoryFor(const std::string& animation, unsigned int denominator) {
+    return animation + "/tier" + std::to_string(denominator);
+}
+
+} // namespace AnimationTiers
+} // namespace Engine
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Engine {
+
+// On-disk layout of assets.pak (little-endian):
+//
+//   Header | entry data ... | TOC (sorted by path) | path string table
+//
+// Uncompressed entries start on ENTRY_ALIGNMENT boundaries so they can be
+// handed out as direct views into the mapped archive.
+namespace AssetArchive {
+
+constexpr char MAGIC[8] = {'T', 'S', 'S', 'P', 'A', 'K', '\0', '\0'};
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint64_t ENTRY_ALIGNMENT = 4096;
+constexpr const char* DEFAULT_NAME = "assets.pak";
+
+enum class Compression : std::uint8_t {
+    None = 0,
+    Lz = 1
+};
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint64_t tocOffset;
+    std::uint64_t stringsOffset;
+    std::uint64_t stringsSize;
+};
+
+struct TocEntry {
+    std::uint64_t offset;       // Start of stored bytes
+    std::uint64_t storedSize;   // Bytes on disk
+    std::uint64_t size;         // Bytes after decompression
+    std::uint32_t pathOffset;   // Into the string table
+    std::uint16_t pathLength;
+    std::uint8_t compression;
+    std::uint8_t reserved;
+};
+
+static_assert(sizeof(Header) == 40, "AssetArchive::Header layout changed");
+static_assert(sizeof(TocEntry) == 32, "AssetArchive::TocEntry layout changed");
+
+inline bool hasValidMagic(const Header& header) {
+    return std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+inline std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace AssetArchive
+} // namespace Engine
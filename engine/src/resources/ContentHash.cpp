@@ -0,0 +1,99 @@
+#include "ContentHash.hpp"
+#include <cstring>
+
+namespace Engine {
+namespace ContentHash {
+
+namespace {
+    constexpr std::uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr std::uint64_t PRIME3 = 0x165667B19E3779F9ull;
+    constexpr std::uint64_t PRIME4 = 0x85EBCA77C2B2AE63ull;
+    constexpr std::uint64_t PRIME5 = 0x27D4EB2F165667C5ull;
+
+    inline std::uint64_t rotl(std::uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    // Little-endian loads; every platform we ship on is little-endian
+    inline std::uint64_t read64(const unsigned char* p) {
+        std::uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline std::uint32_t read32(const unsigned char* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline std::uint64_t round(std::uint64_t acc, std::uint64_t input) {
+        acc += input * PRIME2;
+        acc = rotl(acc, 31);
+        return acc * PRIME1;
+    }
+
+    inline std::uint64_t mergeRound(std::uint64_t acc, std::uint64_t value) {
+        acc ^= round(0, value);
+        return acc * PRIME1 + PRIME4;
+    }
+}
+
+std::uint64_t xxh64(const void* data, std::size_t size, std::uint64_t seed) {
+    auto p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + size;
+    std::uint64_t hash;
+
+    if (size >= 32) {
+        // Four independent lanes over 32-byte stripes
+        std::uint64_t v1 = seed + PRIME1 + PRIME2;
+        std::uint64_t v2 = seed + PRIME2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - PRIME1;
+        const unsigned char* limit = end - 32;
+        do {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        hash = mergeRound(hash, v1);
+        hash = mergeRound(hash, v2);
+        hash = mergeRound(hash, v3);
+        hash = mergeRound(hash, v4);
+    } else {
+        hash = seed + PRIME5;
+    }
+
+    hash += static_cast<std::uint64_t>(size);
+
+    // Tail: 8, then 4, then single bytes
+    for (; p + 8 <= end; p += 8) {
+        hash ^= round(0, read64(p));
+        hash = rotl(hash, 27) * PRIME1 + PRIME4;
+    }
+    if (p + 4 <= end) {
+        hash ^= static_cast<std::uint64_t>(read32(p)) * PRIME1;
+        hash = rotl(hash, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        hash ^= (*p) * PRIME5;
+        hash = rotl(hash, 11) * PRIME1;
+    }
+
+    // Avalanche
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace ContentHash
+} // namespace Engine
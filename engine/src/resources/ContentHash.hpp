@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+namespace ContentHash {
+
+// XXH64 of a byte range. Fast enough to run over every compressed frame as
+// it is loaded (several GB/s); used to recognize identical assets, not for
+// anything security related.
+std::uint64_t xxh64(const void* data, std::size_t size, std::uint64_t seed = 0);
+
+} // namespace ContentHash
+} // namespace Engine
@@ -0,0 +1,209 @@
+#include "JpegDecoder.hpp"
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+#include <jpeglib.h>
+
+#ifndef JCS_ALPHA_EXTENSIONS
+#error "JpegDecoder requires libjpeg-turbo (JCS_EXT_RGBA output)"
+#endif
+
+namespace Engine {
+namespace JpegDecoder {
+
+namespace {
+    // libjpeg's default error handler calls exit(); jump back out instead
+    struct ErrorManager {
+        jpeg_error_mgr base;
+        std::jmp_buf jump;
+    };
+
+    void onError(j_common_ptr info) {
+        std::longjmp(reinterpret_cast<ErrorManager*>(info->err)->jump, 1);
+    }
+
+    void onMessage(j_common_ptr) {
+        // Corrupt-data warnings are not interesting for animation frames
+    }
+
+    // Sets up a decompressor on the header of `data` and runs `body` on it.
+    // Any libjpeg error inside body unwinds here, so body must not own
+    // anything with a destructor.
+    template <typename Body>
+    bool decode(const void* data, std::size_t size, Body&& body) {
+        if (!isJpeg(data, size)) {
+            return false;
+        }
+
+        jpeg_decompress_struct info;
+        ErrorManager errors;
+        info.err = jpeg_std_error(&errors.base);
+        errors.base.error_exit = onError;
+        errors.base.output_message = onMessage;
+
+        if (setjmp(errors.jump)) {
+            jpeg_destroy_decompress(&info);
+            return false;
+        }
+
+        jpeg_create_decompress(&info);
+        jpeg_mem_src(&info, static_cast<const unsigned char*>(data), static_cast<unsigned long>(size));
+        jpeg_read_header(&info, TRUE);
+
+        bool result = body(info);
+        jpeg_destroy_decompress(&info);
+        return result;
+    }
+
+    bool isValidDenominator(unsigned int denominator) {
+        return denominator == 1 || denominator == 2 || denominator == 4 || denominator == 8;
+    }
+
+    bool isYuv420(const jpeg_decompress_struct& info) {
+        if (info.num_components != 3 || info.jpeg_color_space != JCS_YCbCr) {
+            return false;
+        }
+        const jpeg_component_info* components = info.comp_info;
+        return components[0].h_samp_factor == 2 && components[0].v_samp_factor == 2 &&
+               components[1].h_samp_factor == 1 && components[1].v_samp_factor == 1 &&
+               components[2].h_samp_factor == 1 && components[2].v_samp_factor == 1;
+    }
+
+    int scaledBlockSize(const jpeg_component_info& component) {
+#if JPEG_LIB_VERSION >= 70
+        return component.DCT_v_scaled_size;
+#else
+        return component.DCT_scaled_size;
+#endif
+    }
+
+    unsigned int alignStride(unsigned int stride) {
+        return (stride + 3u) & ~3u;
+    }
+}
+
+bool isJpeg(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    return bytes && size >= 3 && bytes[0] == 0xFF && bytes[1] == 0xD8 && bytes[2] == 0xFF;
+}
+
+bool readSize(const void* data, std::size_t size, unsigned int& width, unsigned int& height) {
+    return decode(data, size, [&](jpeg_decompress_struct& info) {
+        width = info.image_width;
+        height = info.image_height;
+        return true;
+    });
+}
+
+unsigned int chooseScaleDenominator(unsigned int width, unsigned int height,
+                                    unsigned int targetWidth, unsigned int targetHeight) {
+    for (unsigned int denominator : SCALE_DENOMINATORS) {
+        unsigned int scaledWidth = (width + denominator - 1) / denominator;
+        unsigned int scaledHeight = (height + denominator - 1) / denominator;
+        if (scaledWidth >= targetWidth && scaledHeight >= targetHeight) {
+            return denominator;
+        }
+    }
+    return 1;
+}
+
+bool decodeRgba(const void* data, std::size_t size, RgbaImage& out, unsigned int scaleDenominator) {
+    if (!isValidDenominator(scaleDenominator)) {
+        return false;
+    }
+
+    return decode(data, size, [&](jpeg_decompress_struct& info) {
+        info.out_color_space = JCS_EXT_RGBA;
+        info.scale_num = 1;
+        info.scale_denom = scaleDenominator;
+        jpeg_start_decompress(&info);
+
+        out.width = info.output_width;
+        out.height = info.output_height;
+        out.pixels.resize(static_cast<std::size_t>(out.width) * out.height * 4);
+
+        // Decode straight into the output, a few rows per call
+        const std::size_t stride = static_cast<std::size_t>(out.width) * 4;
+        JSAMPROW rows[16];
+        while (info.output_scanline < info.output_height) {
+            const unsigned int first = info.output_scanline;
+            const unsigned int count = std::min(16u, info.output_height - first);
+            for (unsigned int i = 0; i < count; ++i) {
+                rows[i] = &out.pixels[(first + i) * stride];
+            }
+            if (jpeg_read_scanlines(&info, rows, count) == 0) {
+                return false;
+            }
+        }
+
+        jpeg_finish_decompress(&info);
+        return true;
+    });
+}
+
+bool decodeYuv420(const void* data, std::size_t size, YuvImage& out, unsigned int scaleDenominator) {
+    if (!isValidDenominator(scaleDenominator)) {
+        return false;
+    }
+
+    return decode(data, size, [&](jpeg_decompress_struct& info) {
+        if (!isYuv420(info)) {
+            return false;
+        }
+
+        info.raw_data_out = TRUE;
+        info.scale_num = 1;
+        info.scale_denom = scaleDenominator;
+        jpeg_start_decompress(&info);
+
+        // When scaling, libjpeg-turbo widens the chroma IDCT instead of
+        // upsampling, so chroma can come out at luma resolution
+        const jpeg_component_info& lumaInfo = info.comp_info[0];
+        const jpeg_component_info& chromaInfo = info.comp_info[1];
+        const unsigned int lumaBlock = scaledBlockSize(lumaInfo);
+        const unsigned int chromaBlock = scaledBlockSize(chromaInfo);
+        const unsigned int lumaRowsPerCall = lumaInfo.v_samp_factor * lumaBlock;
+        const unsigned int chromaRowsPerCall = chromaInfo.v_samp_factor * chromaBlock;
+        if (lumaRowsPerCall > 2 * DCTSIZE || chromaRowsPerCall > 2 * DCTSIZE) {
+            return false;
+        }
+
+        // Planes cover whole MCUs so every raw row libjpeg writes is in bounds
+        out.width = info.output_width;
+        out.height = info.output_height;
+        out.lumaStride = alignStride(info.MCUs_per_row * lumaInfo.h_samp_factor * lumaBlock);
+        out.chromaStride = alignStride(info.MCUs_per_row * chromaInfo.h_samp_factor * chromaBlock);
+        out.chromaWidth = chromaInfo.downsampled_width;
+        out.chromaHeight = chromaInfo.downsampled_height;
+        out.chromaDivisor = (lumaInfo.h_samp_factor * lumaBlock) / (chromaInfo.h_samp_factor * chromaBlock);
+        out.luma.resize(static_cast<std::size_t>(out.lumaStride) * info.total_iMCU_rows * lumaRowsPerCall);
+        out.chromaB.resize(static_cast<std::size_t>(out.chromaStride) * info.total_iMCU_rows * chromaRowsPerCall);
+        out.chromaR.resize(out.chromaB.size());
+
+        // One iMCU row per call
+        JSAMPROW lumaRows[2 * DCTSIZE];
+        JSAMPROW chromaBRows[2 * DCTSIZE];
+        JSAMPROW chromaRRows[2 * DCTSIZE];
+        JSAMPARRAY planes[3] = { lumaRows, chromaBRows, chromaRRows };
+
+        for (unsigned int mcuRow = 0; info.output_scanline < info.output_height; ++mcuRow) {
+            for (unsigned int i = 0; i < lumaRowsPerCall; ++i) {
+                lumaRows[i] = &out.luma[(mcuRow * lumaRowsPerCall + i) * static_cast<std::size_t>(out.lumaStride)];
+            }
+            for (unsigned int i = 0; i < chromaRowsPerCall; ++i) {
+                std::size_t offset = (mcuRow * chromaRowsPerCall + i) * static_cast<std::size_t>(out.chromaStride);
+                chromaBRows[i] = &out.chromaB[offset];
+                chromaRRows[i] = &out.chromaR[offset];
+            }
+            if (jpeg_read_raw_data(&info, planes, lumaRowsPerCall) == 0) {
+                return false;
+            }
+        }
+
+        jpeg_finish_decompress(&info);
+        return true;
+    });
+}
+
+} // namespace JpegDecoder
+} // namespace Engine
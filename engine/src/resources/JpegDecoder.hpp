@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Tightly packed RGBA8 pixels, as sf::Image expects them
+struct RgbaImage {
+    unsigned int width = 0;
+    unsigned int height = 0;
+    std::vector<std::uint8_t> pixels;
+};
+
+// Planar YCbCr 4:2:0 image as stored in the JPEG, before color conversion.
+// Rows are padded to whole DCT blocks; strides are multiples of 4 bytes so a
+// plane can be uploaded as an RGBA texture holding 4 samples per texel.
+struct YuvImage {
+    unsigned int width = 0;          // Frame size in pixels
+    unsigned int height = 0;
+    unsigned int lumaStride = 0;     // Bytes per luma row
+    unsigned int chromaStride = 0;   // Bytes per Cb/Cr row
+    unsigned int chromaWidth = 0;    // Chroma samples covering the frame
+    unsigned int chromaHeight = 0;
+    unsigned int chromaDivisor = 2;  // Luma samples per chroma sample (1 in scaled decodes)
+    std::vector<std::uint8_t> luma;
+    std::vector<std::uint8_t> chromaB;
+    std::vector<std::uint8_t> chromaR;
+
+    std::size_t getMemoryUsage() const { return luma.size() + chromaB.size() + chromaR.size(); }
+};
+
+// libjpeg-turbo decoding (SIMD IDCT, upsampling and color conversion).
+//
+// Both decoders can scale in the DCT domain: with a denominator of 2, 4 or 8
+// the IDCT only produces that fraction of each block, so a 1/4 decode does
+// roughly a sixteenth of the pixel work instead of decoding at full size and
+// downscaling afterwards. Scaled sizes round up (ceil(width / denominator)).
+namespace JpegDecoder {
+
+// Denominators libjpeg-turbo scales by with a plain 8x8 IDCT, largest first
+constexpr unsigned int SCALE_DENOMINATORS[] = { 8, 4, 2, 1 };
+
+bool isJpeg(const void* data, std::size_t size);
+
+// Reads only the header
+bool readSize(const void* data, std::size_t size, unsigned int& width, unsigned int& height);
+
+// Largest denominator whose output still covers targetWidth x targetHeight,
+// i.e. is never upscaled when drawn filling that area. A zero target
+// dimension means "no constraint" on that axis.
+unsigned int chooseScaleDenominator(unsigned int width, unsigned int height,
+                                    unsigned int targetWidth, unsigned int targetHeight);
+
+// Returns false (without printing) if the data is corrupt or in a color
+// space libjpeg-turbo cannot convert to RGBA (e.g. CMYK)
+bool decodeRgba(const void* data, std::size_t size, RgbaImage& out, unsigned int scaleDenominator = 1);
+
+// Decodes with libjpeg-turbo's raw data output, skipping upsampling and
+// color conversion. Returns false (without printing) if the image is not
+// 3-component YCbCr with 2x2 luma / 1x1 chroma sampling, or is corrupt;
+// callers fall back to a regular RGBA decode.
+bool decodeYuv420(const void* data, std::size_t size, YuvImage& out, unsigned int scaleDenominator = 1);
+
+} // namespace JpegDecoder
+} // namespace Engine
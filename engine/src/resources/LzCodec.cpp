@@ -0,0 +1,156 @@
+#include "LzCodec.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace Engine {
+namespace LzCodec {
+
+namespace {
+    constexpr std::size_t MIN_MATCH = 4;
+    constexpr std::size_t LAST_LITERALS = 5;   // Block must end with literals
+    constexpr std::size_t MATCH_FIND_LIMIT = 12;
+    constexpr std::size_t MAX_OFFSET = 65535;
+    constexpr int HASH_BITS = 16;
+
+    inline std::uint32_t read32(const unsigned char* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline std::uint32_t hashSequence(std::uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    void writeLength(std::vector<char>& out, std::size_t length) {
+        while (length >= 255) {
+            out.push_back(static_cast<char>(255));
+            length -= 255;
+        }
+        out.push_back(static_cast<char>(length));
+    }
+
+    bool readLength(const unsigned char*& ip, const unsigned char* ipEnd, std::size_t& length) {
+        unsigned char byte;
+        do {
+            if (ip >= ipEnd) return false;
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+std::vector<char> compress(const char* data, std::size_t size) {
+    const auto* src = reinterpret_cast<const unsigned char*>(data);
+    std::vector<char> out;
+    out.reserve(size + size / 255 + 16);
+
+    // Hash table stores position + 1 so zero means "empty"
+    std::vector<std::uint32_t> table(std::size_t(1) << HASH_BITS, 0);
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+
+    if (size > MATCH_FIND_LIMIT) {
+        const std::size_t matchLimit = size - LAST_LITERALS;
+        const std::size_t searchLimit = size - MATCH_FIND_LIMIT;
+
+        while (pos < searchLimit) {
+            std::uint32_t sequence = read32(src + pos);
+            std::uint32_t hash = hashSequence(sequence);
+            std::size_t candidate = table[hash];
+            table[hash] = static_cast<std::uint32_t>(pos + 1);
+
+            if (candidate == 0 || pos - (candidate - 1) > MAX_OFFSET ||
+                read32(src + candidate - 1) != sequence) {
+                ++pos;
+                continue;
+            }
+
+            std::size_t ref = candidate - 1;
+            std::size_t matchLength = MIN_MATCH;
+            while (pos + matchLength < matchLimit && src[ref + matchLength] == src[pos + matchLength]) {
+                ++matchLength;
+            }
+
+            // Emit sequence: token, literal length, literals, offset, match length
+            std::size_t literalLength = pos - anchor;
+            std::size_t extraMatch = matchLength - MIN_MATCH;
+            std::size_t tokenPos = out.size();
+            out.push_back(0);
+            if (literalLength >= 15) writeLength(out, literalLength - 15);
+            out.insert(out.end(), data + anchor, data + pos);
+
+            std::size_t offset = pos - ref;
+            out.push_back(static_cast<char>(offset & 0xFF));
+            out.push_back(static_cast<char>(offset >> 8));
+            if (extraMatch >= 15) writeLength(out, extraMatch - 15);
+
+            unsigned token = (literalLength >= 15 ? 15u : static_cast<unsigned>(literalLength)) << 4;
+            token |= extraMatch >= 15 ? 15u : static_cast<unsigned>(extraMatch);
+            out[tokenPos] = static_cast<char>(token);
+
+            pos += matchLength;
+            anchor = pos;
+        }
+    }
+
+    // Trailing literals
+    std::size_t literalLength = size - anchor;
+    out.push_back(static_cast<char>((literalLength >= 15 ? 15u : static_cast<unsigned>(literalLength)) << 4));
+    if (literalLength >= 15) writeLength(out, literalLength - 15);
+    out.insert(out.end(), data + anchor, data + size);
+
+    return out;
+}
+
+bool decompress(const char* data, std::size_t dataSize, char* out, std::size_t size) {
+    const auto* ip = reinterpret_cast<const unsigned char*>(data);
+    const auto* ipEnd = ip + dataSize;
+    auto* const opStart = reinterpret_cast<unsigned char*>(out);
+    auto* op = opStart;
+    auto* const opEnd = opStart + size;
+
+    while (ip < ipEnd) {
+        unsigned token = *ip++;
+
+        std::size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, ipEnd, literalLength)) return false;
+        if (literalLength > static_cast<std::size_t>(ipEnd - ip) ||
+            literalLength > static_cast<std::size_t>(opEnd - op)) {
+            return false;
+        }
+        std::memcpy(op, ip, literalLength);
+        op += literalLength;
+        ip += literalLength;
+
+        // The final sequence carries literals only
+        if (ip >= ipEnd) break;
+
+        if (ipEnd - ip < 2) return false;
+        std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<std::size_t>(op - opStart)) return false;
+
+        std::size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(ip, ipEnd, matchLength)) return false;
+        matchLength += MIN_MATCH;
+        if (matchLength > static_cast<std::size_t>(opEnd - op)) return false;
+
+        const unsigned char* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+        } else {
+            // Overlapping copy repeats the last `offset` bytes
+            for (std::size_t i = 0; i < matchLength; ++i) {
+                op[i] = match[i];
+            }
+        }
+        op += matchLength;
+    }
+
+    return op == opEnd;
+}
+
+} // namespace LzCodec
+} // namespace Engine
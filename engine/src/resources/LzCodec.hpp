@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+namespace LzCodec {
+
+// Byte-oriented LZ77 block codec (LZ4 block layout). Used for asset archive
+// entries that compress well (JSON, fonts); decoding is a plain memcpy loop.
+std::vector<char> compress(const char* data, std::size_t size);
+
+// Decodes a block into a buffer of exactly `size` bytes.
+// Returns false on malformed input instead of reading/writing out of bounds.
+bool decompress(const char* data, std::size_t dataSize, char* out, std::size_t size);
+
+} // namespace LzCodec
+} // namespace Engine
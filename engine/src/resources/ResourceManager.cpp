@@ -0,0 +1,87 @@
+#include "ResourceManager.hpp"
+#include "JpegDecoder.hpp"
+#include <iostream>
+
+namespace Engine {
+
+AssetFile ResourceManager::openRetained(const std::string& path) {
+    std::lock_guard<std::mutex> lock(retainedMutex);
+    if (auto it = retainedFiles.find(path); it != retainedFiles.end()) {
+        return it->second;
+    }
+
+    AssetFile file = VirtualFileSystem::getInstance().open(path);
+    if (file) {
+        retainedFiles[path] = file;
+    }
+    return file;
+}
+
+bool ResourceManager::loadTexture(sf::Texture& texture, const std::string& path, unsigned int scaleDenominator) {
+    AssetFile file = VirtualFileSystem::getInstance().open(path);
+    if (!file) {
+        std::cerr << "ResourceManager: Texture not found: " << path << std::endl;
+        return false;
+    }
+
+    RgbaImage decoded;
+    if (JpegDecoder::decodeRgba(file.data(), file.size(), decoded, scaleDenominator)) {
+        if (!texture.create(decoded.width, decoded.height)) {
+            return false;
+        }
+        texture.update(decoded.pixels.data());
+        return true;
+    }
+    return texture.loadFromMemory(file.data(), file.size());
+}
+
+bool ResourceManager::loadImage(sf::Image& image, const std::string& path, unsigned int scaleDenominator) {
+    AssetFile file = VirtualFileSystem::getInstance().open(path);
+    if (!file) {
+        std::cerr << "ResourceManager: Image not found: " << path << std::endl;
+        return false;
+    }
+
+    RgbaImage decoded;
+    if (JpegDecoder::decodeRgba(file.data(), file.size(), decoded, scaleDenominator)) {
+        image.create(decoded.width, decoded.height, decoded.pixels.data());
+        return true;
+    }
+    return image.loadFromMemory(file.data(), file.size());
+}
+
+bool ResourceManager::loadFont(sf::Font& font, const std::string& path) {
+    // sf::Font reads glyphs from the source lazily, so the bytes must outlive it
+    AssetFile file = openRetained(path);
+    if (!file) {
+        std::cerr << "ResourceManager: Font not found: " << path << std::endl;
+        return false;
+    }
+    return font.loadFromMemory(file.data(), file.size());
+}
+
+bool ResourceManager::loadSoundBuffer(sf::SoundBuffer& buffer, const std::string& path) {
+    AssetFile file = VirtualFileSystem::getInstance().open(path);
+    if (!file) {
+        std::cerr << "ResourceManager: Sound not found: " << path << std::endl;
+        return false;
+    }
+    return buffer.loadFromMemory(file.data(), file.size());
+}
+
+bool ResourceManager::loadJson(nlohmann::json& json, const std::string& path) {
+    AssetFile file = VirtualFileSystem::getInstance().open(path);
+    if (!file) {
+        std::cerr << "ResourceManager: JSON file not found: " << path << std::endl;
+        return false;
+    }
+    try {
+        json = nlohmann::json::parse(file.data(), file.data() + file.size());
+    } catch (const nlohmann::json::exception& e) {
+        std::cerr << "ResourceManager: Failed to parse " << path << ": " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace Engine
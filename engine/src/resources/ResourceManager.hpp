@@ -0,0 +1,44 @@
+#pragma once
+
+#include "VirtualFileSystem.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <nlohmann/json.hpp>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Engine {
+
+// SFML/JSON loaders on top of the VirtualFileSystem. Everything is loaded
+// from memory; sources that SFML keeps reading after open (fonts)
+// have their bytes retained here until the process exits. JPEGs are decoded
+// with libjpeg-turbo (see JpegDecoder) instead of SFML's stb_image.
+class ResourceManager {
+public:
+    static ResourceManager& getInstance() {
+        static ResourceManager instance;
+        return instance;
+    }
+
+    // scaleDenominator (1, 2, 4 or 8) shrinks JPEGs during decoding;
+    // other formats always load at full size
+    bool loadTexture(sf::Texture& texture, const std::string& path, unsigned int scaleDenominator = 1);
+    bool loadImage(sf::Image& image, const std::string& path, unsigned int scaleDenominator = 1);
+    bool loadFont(sf::Font& font, const std::string& path);
+    bool loadSoundBuffer(sf::SoundBuffer& buffer, const std::string& path);
+    bool loadJson(nlohmann::json& json, const std::string& path);
+
+private:
+    ResourceManager() = default;
+    ~ResourceManager() = default;
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+
+    AssetFile openRetained(const std::string& path);
+
+    std::mutex retainedMutex;
+    std::map<std::string, AssetFile> retainedFiles;
+};
+
+} // namespace Engine
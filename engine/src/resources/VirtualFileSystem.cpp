@@ -0,0 +1,381 @@
+#include "VirtualFileSystem.hpp"
+#include "AssetArchive.hpp"
+#include "LzCodec.hpp"
+#include "../core/Logger.hpp"
+#include "../config/AssetPaths.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Engine {
+
+namespace {
+    // Owns a read-only memory mapping
+    struct MappedRegion {
+        void* address = nullptr;
+        std::size_t length = 0;
+
+        ~MappedRegion() {
+            if (address && length) {
+                munmap(address, length);
+            }
+        }
+    };
+
+    std::shared_ptr<MappedRegion> mapFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+            ::close(fd);
+            return nullptr;
+        }
+
+        auto region = std::make_shared<MappedRegion>();
+        region->length = static_cast<std::size_t>(info.st_size);
+        if (region->length > 0) {
+            region->address = mmap(nullptr, region->length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (region->address == MAP_FAILED) {
+                region->address = nullptr;
+                region->length = 0;
+                ::close(fd);
+                return nullptr;
+            }
+        }
+        ::close(fd);
+        return region;
+    }
+
+    bool hasExtension(std::string_view path, const std::string& extension) {
+        return extension.empty() ||
+               (path.size() >= extension.size() &&
+                path.compare(path.size() - extension.size(), extension.size(), extension) == 0);
+    }
+}
+
+class VirtualFileSystem::Mount {
+public:
+    virtual ~Mount() = default;
+    virtual bool exists(const std::string& path) const = 0;
+    virtual bool isDirectory(const std::string& path) const = 0;
+    virtual AssetFile open(const std::string& path) const = 0;
+    virtual void list(const std::string& directory, const std::string& extension,
+                      std::vector<std::string>& out) const = 0;
+
+protected:
+    static AssetFile makeFile(std::shared_ptr<const void> owner, const char* bytes, std::size_t length) {
+        return AssetFile(std::move(owner), bytes, length);
+    }
+};
+
+namespace {
+    // Loose files below a root directory; each open maps the file
+    class DirectoryMount : public VirtualFileSystem::Mount {
+    public:
+        explicit DirectoryMount(std::string root) : root(std::move(root)) {}
+
+        bool exists(const std::string& path) const override {
+            return std::filesystem::is_regular_file(physical(path));
+        }
+
+        bool isDirectory(const std::string& path) const override {
+            return std::filesystem::is_directory(physical(path));
+        }
+
+        AssetFile open(const std::string& path) const override {
+            auto region = mapFile(physical(path));
+            if (!region) {
+                return AssetFile();
+            }
+            const char* bytes = static_cast<const char*>(region->address);
+            std::size_t length = region->length;
+            return makeFile(std::move(region), bytes, length);
+        }
+
+        void list(const std::string& directory, const std::string& extension,
+                  std::vector<std::string>& out) const override {
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator(physical(directory), ec)) {
+                if (!entry.is_regular_file()) continue;
+                std::string name = entry.path().filename().string();
+                if (hasExtension(name, extension)) {
+                    out.push_back(directory + "/" + name);
+                }
+            }
+        }
+
+    private:
+        std::string physical(const std::string& path) const {
+            return root.empty() ? path : root + "/" + path;
+        }
+
+        std::string root;
+    };
+
+    // Packed archive mapped once; entries are looked up in the sorted TOC
+    class ArchiveMount : public VirtualFileSystem::Mount {
+    public:
+        static std::unique_ptr<ArchiveMount> create(const std::string& archivePath) {
+            auto region = mapFile(archivePath);
+            if (!region) {
+                std::cerr << "VirtualFileSystem: Failed to map archive: " << archivePath << std::endl;
+                return nullptr;
+            }
+
+            const char* base = static_cast<const char*>(region->address);
+            const std::uint64_t size = region->length;
+            if (size < sizeof(AssetArchive::Header)) {
+                std::cerr << "VirtualFileSystem: Archive too small: " << archivePath << std::endl;
+                return nullptr;
+            }
+
+            AssetArchive::Header header;
+            std::memcpy(&header, base, sizeof(header));
+            if (!AssetArchive::hasValidMagic(header) || header.version != AssetArchive::VERSION) {
+                std::cerr << "VirtualFileSystem: Unsupported archive format: " << archivePath << std::endl;
+                return nullptr;
+            }
+
+            const std::uint64_t tocSize = std::uint64_t(header.entryCount) * sizeof(AssetArchive::TocEntry);
+            if (header.tocOffset > size || tocSize > size - header.tocOffset ||
+                header.tocOffset % alignof(AssetArchive::TocEntry) != 0 ||
+                header.stringsOffset > size || header.stringsSize > size - header.stringsOffset) {
+                std::cerr << "VirtualFileSystem: Corrupt archive TOC: " << archivePath << std::endl;
+                return nullptr;
+            }
+
+            auto mount = std::unique_ptr<ArchiveMount>(new ArchiveMount());
+            mount->region = std::move(region);
+            mount->entries = reinterpret_cast<const AssetArchive::TocEntry*>(base + header.tocOffset);
+            mount->entryCount = header.entryCount;
+            mount->strings = base + header.stringsOffset;
+            mount->stringsSize = header.stringsSize;
+
+            // Validate every entry once so lookups can trust the TOC
+            for (std::size_t i = 0; i < mount->entryCount; ++i) {
+                const auto& entry = mount->entries[i];
+                if (entry.offset > size || entry.storedSize > size - entry.offset ||
+                    std::uint64_t(entry.pathOffset) + entry.pathLength > header.stringsSize) {
+                    std::cerr << "VirtualFileSystem: Corrupt archive entry " << i << " in " << archivePath << std::endl;
+                    return nullptr;
+                }
+            }
+            return mount;
+        }
+
+        bool exists(const std::string& path) const override {
+            return find(path) != nullptr;
+        }
+
+        bool isDirectory(const std::string& path) const override {
+            std::string prefix = path + "/";
+            const auto* it = lowerBound(prefix);
+            return it != entries + entryCount && pathOf(*it).substr(0, prefix.size()) == prefix;
+        }
+
+        AssetFile open(const std::string& path) const override {
+            const auto* entry = find(path);
+            if (!entry) {
+                return AssetFile();
+            }
+
+            const char* stored = static_cast<const char*>(region->address) + entry->offset;
+            switch (static_cast<AssetArchive::Compression>(entry->compression)) {
+                case AssetArchive::Compression::None:
+                    // Entries are page aligned, so read-ahead covers exactly this file
+                    if (entry->storedSize > 0) {
+                        madvise(const_cast<char*>(stored), entry->storedSize, MADV_WILLNEED);
+                    }
+                    return makeFile(region, stored, entry->storedSize);
+
+                case AssetArchive::Compression::Lz: {
+                    auto buffer = std::make_shared<std::vector<char>>(entry->size);
+                    if (!LzCodec::decompress(stored, entry->storedSize, buffer->data(), buffer->size())) {
+                        std::cerr << "VirtualFileSystem: Failed to decompress " << path << std::endl;
+                        return AssetFile();
+                    }
+                    const char* bytes = buffer->data();
+                    return makeFile(std::move(buffer), bytes, entry->size);
+                }
+            }
+
+            std::cerr << "VirtualFileSystem: Unknown compression for " << path << std::endl;
+            return AssetFile();
+        }
+
+        void list(const std::string& directory, const std::string& extension,
+                  std::vector<std::string>& out) const override {
+            std::string prefix = directory + "/";
+            for (const auto* it = lowerBound(prefix); it != entries + entryCount; ++it) {
+                std::string_view entryPath = pathOf(*it);
+                if (entryPath.substr(0, prefix.size()) != prefix) break;
+
+                // Direct children only
+                std::string_view name = entryPath.substr(prefix.size());
+                if (name.find('/') == std::string_view::npos && hasExtension(name, extension)) {
+                    out.emplace_back(entryPath);
+                }
+            }
+        }
+
+    private:
+        ArchiveMount() = default;
+
+        std::string_view pathOf(const AssetArchive::TocEntry& entry) const {
+            return std::string_view(strings + entry.pathOffset, entry.pathLength);
+        }
+
+        const AssetArchive::TocEntry* lowerBound(std::string_view key) const {
+            return std::lower_bound(entries, entries + entryCount, key,
+                [this](const AssetArchive::TocEntry& entry, std::string_view value) {
+                    return pathOf(entry) < value;
+                });
+        }
+
+        const AssetArchive::TocEntry* find(std::string_view path) const {
+            const auto* it = lowerBound(path);
+            if (it != entries + entryCount && pathOf(*it) == path) {
+                return it;
+            }
+            return nullptr;
+        }
+
+        std::shared_ptr<MappedRegion> region;
+        const AssetArchive::TocEntry* entries = nullptr;
+        std::size_t entryCount = 0;
+        const char* strings = nullptr;
+        std::uint64_t stringsSize = 0;
+    };
+}
+
+VirtualFileSystem::VirtualFileSystem() {
+    mountDefault();
+}
+
+VirtualFileSystem::~VirtualFileSystem() = default;
+
+VirtualFileSystem& VirtualFileSystem::getInstance() {
+    static VirtualFileSystem instance;
+    return instance;
+}
+
+void VirtualFileSystem::mountDefault() {
+    namespace fs = std::filesystem;
+
+    // Search order: executable dir, cwd, dev tree
+    const std::string exeDir = AssetPaths::getExecutableDir();
+    const std::vector<std::string> roots = { exeDir, ".", "engine" };
+
+    for (const auto& root : roots) {
+        std::string archivePath = root + "/" + AssetArchive::DEFAULT_NAME;
+        if (fs::is_regular_file(archivePath) && mountArchive(archivePath)) {
+            return;
+        }
+    }
+
+    for (const auto& root : roots) {
+        if (fs::is_directory(root + "/" + AssetPaths::ASSETS_DIR)) {
+            mountDirectory(root);
+            return;
+        }
+    }
+
+    std::cerr << "VirtualFileSystem: No asset archive or directory found" << std::endl;
+}
+
+bool VirtualFileSystem::mountDirectory(const std::string& rootDir) {
+    if (!std::filesystem::is_directory(rootDir)) {
+        std::cerr << "VirtualFileSystem: Not a directory: " << rootDir << std::endl;
+        return false;
+    }
+    mounts.push_back(std::make_unique<DirectoryMount>(rootDir));
+    TSS_LOG_INFO("VirtualFileSystem", "Mounted directory", field("path", rootDir));
+    return true;
+}
+
+bool VirtualFileSystem::mountArchive(const std::string& archivePath) {
+    auto mount = ArchiveMount::create(archivePath);
+    if (!mount) {
+        return false;
+    }
+    mounts.push_back(std::move(mount));
+    TSS_LOG_INFO("VirtualFileSystem", "Mounted archive", field("path", archivePath));
+    return true;
+}
+
+void VirtualFileSystem::unmountAll() {
+    mounts.clear();
+}
+
+std::string VirtualFileSystem::normalize(const std::string& path) {
+    std::string result;
+    result.reserve(path.size());
+    for (char c : path) {
+        char ch = (c == '\\') ? '/' : c;
+        // Collapse repeated separators
+        if (ch == '/' && !result.empty() && result.back() == '/') continue;
+        result.push_back(ch);
+    }
+    while (result.compare(0, 2, "./") == 0) {
+        result.erase(0, 2);
+    }
+    while (!result.empty() && result.back() == '/') {
+        result.pop_back();
+    }
+    return result;
+}
+
+bool VirtualFileSystem::exists(const std::string& path) const {
+    std::string logical = normalize(path);
+    for (const auto& mount : mounts) {
+        if (mount->exists(logical)) return true;
+    }
+    return false;
+}
+
+bool VirtualFileSystem::isDirectory(const std::string& path) const {
+    std::string logical = normalize(path);
+    for (const auto& mount : mounts) {
+        if (mount->isDirectory(logical)) return true;
+    }
+    return false;
+}
+
+AssetFile VirtualFileSystem::open(const std::string& path) const {
+    std::string logical = normalize(path);
+    for (const auto& mount : mounts) {
+        if (AssetFile file = mount->open(logical)) {
+            return file;
+        }
+    }
+    return AssetFile();
+}
+
+bool VirtualFileSystem::read(const std::string& path, std::string& out) const {
+    AssetFile file = open(path);
+    if (!file) {
+        return false;
+    }
+    out.assign(file.data(), file.size());
+    return true;
+}
+
+std::vector<std::string> VirtualFileSystem::list(const std::string& directory, const std::string& extension) const {
+    std::string logical = normalize(directory);
+    std::vector<std::string> result;
+    for (const auto& mount : mounts) {
+        mount->list(logical, extension, result);
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+} // namespace Engine
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine {
+
+// Read-only view of an asset's bytes. Keeps the backing storage (a memory
+// mapping or a decompressed buffer) alive for as long as any copy exists.
+class AssetFile {
+public:
+    AssetFile() = default;
+
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+    std::string_view view() const { return std::string_view(bytes, length); }
+    bool isValid() const { return owner != nullptr; }
+    explicit operator bool() const { return isValid(); }
+
+private:
+    friend class VirtualFileSystem;
+
+    AssetFile(std::shared_ptr<const void> owner, const char* bytes, std::size_t length)
+        : owner(std::move(owner)), bytes(bytes), length(length) {}
+
+    std::shared_ptr<const void> owner;
+    const char* bytes = nullptr;
+    std::size_t length = 0;
+};
+
+// Resolves logical asset paths ("assets/textures/ui/warning.jpg") against
+// mounted sources: a packed assets.pak or the loose assets directory.
+// Mounts are searched in the order they were added. The instance starts
+// with the default mount: assets.pak if one ships next to the executable,
+// otherwise the loose assets directory.
+class VirtualFileSystem {
+public:
+    static VirtualFileSystem& getInstance();
+
+    bool mountDirectory(const std::string& rootDir);
+    bool mountArchive(const std::string& archivePath);
+    void unmountAll();
+
+    bool exists(const std::string& path) const;
+    bool isDirectory(const std::string& path) const;
+
+    // Zero-copy view (mmap of a loose file or of the archive entry)
+    AssetFile open(const std::string& path) const;
+
+    // Copies the asset into `out`
+    bool read(const std::string& path, std::string& out) const;
+
+    // Logical paths of the direct children of `directory` with the given
+    // extension (empty for any), sorted by name
+    std::vector<std::string> list(const std::string& directory, const std::string& extension = "") const;
+
+    class Mount;
+
+private:
+    VirtualFileSystem();
+    ~VirtualFileSystem();
+    VirtualFileSystem(const VirtualFileSystem&) = delete;
+    VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+    void mountDefault();
+    static std::string normalize(const std::string& path);
+
+    std::vector<std::unique_ptr<Mount>> mounts;
+};
+
+} // namespace Engine
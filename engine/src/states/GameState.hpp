@@ -10,5 +10,11 @@ public:
     virtual void cleanup() = 0;
     virtual void handleInput(sf::RenderWindow& window) = 0;
     virtual void update(float deltaTime) = 0;
-    virtual void draw(sf::RenderWindow& window) = 0;
+    virtual void draw(sf::RenderTarget& target) = 0;
+
+    // True while nothing the state draws changes by itself (no playing
+    // animation, no per-frame shader uniforms or render-to-texture). The
+    // frame is then redrawn only when its submissions differ from the last
+    // presented frame.
+    virtual bool isStatic() const { return false; }
 };
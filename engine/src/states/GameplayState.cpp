@@ -0,0 +1,436 @@
+#include "GameplayState.hpp"
+#include "../core/JobSystem.hpp"
+#include "../core/Logger.hpp"
+#include "../core/SaveSystem.hpp"
+#include "../core/StateManager.hpp"
+#include "MainMenuState.hpp"
+#include "../config/AssetPaths.hpp"
+#include "../resources/VirtualFileSystem.hpp"
+#include "../systems/audio_systems/AudioSystem.hpp"
+#include "../systems/camera_systems/CameraSystem.hpp"
+#include "../systems/camera_systems/FlashlightSystem.hpp"
+#include "../systems/render/RenderQueue.hpp"
+#include "../systems/ui/ScalingManager.hpp"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <iostream>
+
+using Engine::PowerDevice;
+using Engine::Room;
+
+namespace {
+    // Sound names from audio_config.json; missing ones are never queued
+    constexpr const char* DOOR_SOUND = "door";
+    constexpr const char* LIGHT_SOUND = "light-buzz";
+    constexpr const char* FOOTSTEPS_SOUND = "footsteps";
+    constexpr const char* POWER_DOWN_SOUND = "power-down";
+    constexpr const char* JUMPSCARE_SOUND = "jumpscare";
+    constexpr const char* CHIMES_SOUND = "chimes";
+
+    // Virtual angles of the two doorways
+    constexpr float WEST_ANGLE = -90.0f;
+    constexpr float EAST_ANGLE = 90.0f;
+
+    // Seconds on the end screen before returning to the menu
+    constexpr float END_DELAY = 3.0f;
+
+    // Freddy, Bonnie, Chica, Foxy per night
+    constexpr int NIGHT_LEVELS[][Engine::ANIMATRONIC_KIND_COUNT] = {
+        { 0, 0, 0, 0 },
+        { 0, 3, 1, 1 },
+        { 1, 0, 5, 2 },
+        { 2, 2, 4, 6 },
+        { 3, 5, 7, 5 },
+        { 4, 10, 12, 16 },
+        { 20, 20, 20, 20 },
+    };
+    constexpr int NIGHT_COUNT = static_cast<int>(sizeof(NIGHT_LEVELS) / sizeof(NIGHT_LEVELS[0]));
+
+    // Camera keys 1-9 and 0, in monitor map order (the kitchen is audio only)
+    const std::array<std::pair<sf::Keyboard::Key, Room>, 10> CAMERA_KEYS = {{
+        { sf::Keyboard::Num1, Room::ShowStage },
+        { sf::Keyboard::Num2, Room::DiningArea },
+        { sf::Keyboard::Num3, Room::PirateCove },
+        { sf::Keyboard::Num4, Room::WestHall },
+        { sf::Keyboard::Num5, Room::WestHallCorner },
+        { sf::Keyboard::Num6, Room::SupplyCloset },
+        { sf::Keyboard::Num7, Room::EastHall },
+        { sf::Keyboard::Num8, Room::EastHallCorner },
+        { sf::Keyboard::Num9, Room::Backstage },
+        { sf::Keyboard::Num0, Room::Restrooms },
+    }};
+
+    // Monitor label of each camera; the art is AssetPaths::CAMERAS_DIR/cam-<label>.jpg
+    const std::array<std::pair<Room, const char*>, 10> CAMERA_FEEDS = {{
+        { Room::ShowStage, "1a" },
+        { Room::DiningArea, "1b" },
+        { Room::PirateCove, "1c" },
+        { Room::WestHall, "2a" },
+        { Room::WestHallCorner, "2b" },
+        { Room::SupplyCloset, "3" },
+        { Room::EastHall, "4a" },
+        { Room::EastHallCorner, "4b" },
+        { Room::Backstage, "5" },
+        { Room::Restrooms, "7" },
+    }};
+
+    std::size_t deviceIndex(PowerDevice device) {
+        return static_cast<std::size_t>(device);
+    }
+
+    // Normalized rect to render target pixels
+    sf::FloatRect toScreen(float x, float y, float width, float height) {
+        sf::Vector2u size = Engine::ScalingManager::getInstance().getRenderSize();
+        return sf::FloatRect(x * size.x, y * size.y, width * size.x, height * size.y);
+    }
+}
+
+Engine::NightSettings GameplayState::settingsForNight(int night) {
+    const int* levels = NIGHT_LEVELS[std::clamp(night, 1, NIGHT_COUNT) - 1];
+    Engine::NightSettings settings;
+    std::copy(levels, levels + Engine::ANIMATRONIC_KIND_COUNT, settings.aiLevels.begin());
+    settings.seed = static_cast<std::uint32_t>(std::time(nullptr));
+    return settings;
+}
+
+GameplayState::GameplayState(int night)
+    : night(night)
+    , session(settingsForNight(night))
+    , monitorOpen(false)
+    , heardPowerOut(false)
+{
+    init();
+}
+
+GameplayState::~GameplayState() {
+    Engine::TimerWheel::getInstance().cancel(endTimer);
+}
+
+void GameplayState::init() {
+    TSS_LOG_DEBUG("GameplayState", "Initializing", Engine::field("night", night),
+                  Engine::field("workers", Engine::JobSystem::getInstance().getWorkerCount()));
+
+    session.setJobSystem(&Engine::JobSystem::getInstance());
+
+    auto& audio = Engine::AudioSystem::getInstance();
+    audio.stopMusic("menu-start");
+    audio.stopMusic("menu-loop");
+
+    // Feeds without art get a flat placeholder so the monitor still works
+    auto& cameras = Engine::CameraSystem::getInstance();
+    const auto& vfs = Engine::VirtualFileSystem::getInstance();
+    for (const auto& [room, label] : CAMERA_FEEDS) {
+        if (cameras.hasFeed(room)) {
+            continue;
+        }
+        std::string path = AssetPaths::CAMERAS_DIR + "/cam-" + label + ".jpg";
+        if (!vfs.exists(path) || !cameras.addFeed(room, path)) {
+            auto shade = static_cast<sf::Uint8>(30 + 8 * static_cast<int>(room));
+            cameras.addPlaceholderFeed(room, sf::Color(shade / 2, shade, shade / 2));
+        }
+    }
+
+    auto& flashlight = Engine::FlashlightSystem::getInstance();
+    flashlight.setAmbient(sf::Color(24, 24, 32));
+    flashlight.setFlashlight(true);
+
+    const sf::Color hudColor(200, 220, 200);
+    clockText.setFont(AssetPaths::OCRAEXT);
+    clockText.setBaseSize(32.0f);
+    clockText.setColor(hudColor);
+    clockText.setPosition(sf::Vector2f(0.97f, 0.07f), Engine::Anchor::TopRight);
+    nightText.setFont(AssetPaths::OCRAEXT);
+    nightText.setBaseSize(20.0f);
+    nightText.setColor(hudColor);
+    nightText.setPosition(sf::Vector2f(0.97f, 0.13f), Engine::Anchor::TopRight);
+    nightText.setNumber("Night ", night);
+    powerText.setFont(AssetPaths::OCRAEXT);
+    powerText.setBaseSize(20.0f);
+    powerText.setColor(hudColor);
+    powerText.setPosition(sf::Vector2f(0.03f, 0.87f), Engine::Anchor::BottomLeft);
+
+    takeSnapshot();
+    heardRooms = snapshot.agents.room;
+    buildRenderPacket();
+}
+
+void GameplayState::cleanup() {
+    Engine::CameraSystem::getInstance().setMonitorOpen(false);
+    Engine::FlashlightSystem::getInstance().clearLights();
+}
+
+void GameplayState::handleInput(sf::RenderWindow& window) {
+    // Toggles fire on the press, not while held
+    std::array<bool, 3> keys = {
+        sf::Keyboard::isKeyPressed(sf::Keyboard::Q),
+        sf::Keyboard::isKeyPressed(sf::Keyboard::E),
+        sf::Keyboard::isKeyPressed(sf::Keyboard::Space)
+    };
+    input.toggleLeftDoor |= keys[0] && !heldKeys[0];
+    input.toggleRightDoor |= keys[1] && !heldKeys[1];
+    input.toggleMonitor |= keys[2] && !heldKeys[2];
+    heldKeys = keys;
+
+    input.leftLight = sf::Keyboard::isKeyPressed(sf::Keyboard::Z);
+    input.rightLight = sf::Keyboard::isKeyPressed(sf::Keyboard::C);
+
+    for (const auto& [key, room] : CAMERA_KEYS) {
+        if (sf::Keyboard::isKeyPressed(key)) {
+            input.selectFeed = room;
+        }
+    }
+
+    sf::Vector2i mouse = sf::Mouse::getPosition(window);
+    input.cursor = Engine::ScalingManager::getInstance().convertScreenToNormalized(
+        static_cast<float>(mouse.x), static_cast<float>(mouse.y));
+}
+
+void GameplayState::update(float deltaTime) {
+    if (snapshot.outcome != Engine::NightOutcome::Running) {
+        return;
+    }
+
+    try {
+        applyInput();
+
+        auto& jobs = Engine::JobSystem::getInstance();
+        Engine::JobCounter counter;
+        jobs.submit(counter, [this, deltaTime] { session.update(deltaTime); });
+        jobs.submit(counter, [this] { generateAudio(); });
+        jobs.submit(counter, [this] { updateCameras(); });
+        jobs.wait(counter);
+
+        takeSnapshot();
+        buildRenderPacket();
+        executeAudio();
+
+        if (snapshot.outcome != Engine::NightOutcome::Running) {
+            finishNight();
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "GameplayState: Error during update: " << e.what() << std::endl;
+    }
+}
+
+void GameplayState::applyInput() {
+    auto toggle = [this](PowerDevice device) {
+        session.setDevice(device, !snapshot.devices[deviceIndex(device)]);
+    };
+    if (input.toggleLeftDoor) {
+        toggle(PowerDevice::LeftDoor);
+    }
+    if (input.toggleRightDoor) {
+        toggle(PowerDevice::RightDoor);
+    }
+    if (input.toggleMonitor) {
+        monitorOpen = !monitorOpen;
+    }
+    if (input.selectFeed != Room::Count) {
+        session.setWatchedRoom(input.selectFeed);
+    }
+
+    // Lights only while held, and not through the monitor
+    session.setDevice(PowerDevice::LeftLight, input.leftLight && !monitorOpen);
+    session.setDevice(PowerDevice::RightLight, input.rightLight && !monitorOpen);
+    if (!session.setDevice(PowerDevice::Camera, monitorOpen)) {
+        monitorOpen = false;
+    }
+
+    packet.cursor = input.cursor;
+    input = GameplayInput();
+}
+
+void GameplayState::generateAudio() {
+    audioCommands.clear();
+
+    // Reads the sound table only; it does not change during a night
+    const auto& audio = Engine::AudioSystem::getInstance();
+    auto queue = [&](AudioCommandType type, const char* name, float angle) {
+        if (audio.hasSound(name)) {
+            audioCommands.push_back({ type, name, angle });
+        }
+    };
+
+    for (std::size_t i = 0; i < snapshot.agents.size() && i < heardRooms.size(); ++i) {
+        Room room = snapshot.agents.room[i];
+        if (room == heardRooms[i]) {
+            continue;
+        }
+        if (room == Room::WestDoor || room == Room::EastDoor) {
+            float angle = room == Room::WestDoor ? WEST_ANGLE : EAST_ANGLE;
+            queue(AudioCommandType::Position, FOOTSTEPS_SOUND, angle);
+            queue(AudioCommandType::PlaySound, FOOTSTEPS_SOUND, 0.0f);
+        }
+        heardRooms[i] = room;
+    }
+
+    for (PowerDevice door : { PowerDevice::LeftDoor, PowerDevice::RightDoor }) {
+        std::size_t d = deviceIndex(door);
+        if (snapshot.devices[d] != heardDevices[d]) {
+            queue(AudioCommandType::PlaySound, DOOR_SOUND, 0.0f);
+        }
+    }
+    bool lightOn = snapshot.devices[deviceIndex(PowerDevice::LeftLight)] ||
+                   snapshot.devices[deviceIndex(PowerDevice::RightLight)];
+    bool lightWasOn = heardDevices[deviceIndex(PowerDevice::LeftLight)] ||
+                      heardDevices[deviceIndex(PowerDevice::RightLight)];
+    if (lightOn != lightWasOn) {
+        queue(lightOn ? AudioCommandType::PlaySound : AudioCommandType::StopSound, LIGHT_SOUND, 0.0f);
+    }
+    heardDevices = snapshot.devices;
+
+    if (snapshot.powerOut && !heardPowerOut) {
+        queue(AudioCommandType::StopSound, LIGHT_SOUND, 0.0f);
+        queue(AudioCommandType::PlaySound, POWER_DOWN_SOUND, 0.0f);
+        heardPowerOut = true;
+    }
+}
+
+void GameplayState::updateCameras() {
+    // Opening the monitor follows the render packet, in draw()
+    auto& cameras = Engine::CameraSystem::getInstance();
+    cameras.selectFeed(snapshot.watchedRoom);
+    cameras.updateOccupancy(snapshot.agents);
+}
+
+void GameplayState::takeSnapshot() {
+    const auto& breaker = session.getBreaker();
+    snapshot.agents = session.getAI().getAgents();
+    snapshot.watchedRoom = session.getWatchedRoom();
+    for (std::size_t d = 0; d < Engine::POWER_DEVICE_COUNT; ++d) {
+        snapshot.devices[d] = breaker.isOn(static_cast<PowerDevice>(d));
+    }
+    snapshot.outcome = session.getOutcome();
+    snapshot.time = session.getTime();
+    snapshot.power = session.getPower();
+    snapshot.usage = breaker.getUsage();
+    snapshot.powerOut = breaker.isPowerOut();
+}
+
+void GameplayState::buildRenderPacket() {
+    packet.devices = snapshot.devices;
+    packet.powerOut = snapshot.powerOut;
+    packet.power = snapshot.power;
+    packet.usage = snapshot.usage;
+    packet.hour = std::min(6, static_cast<int>(snapshot.time / session.getNightLength() * 6.0f));
+
+    packet.westDoorOccupied = false;
+    packet.eastDoorOccupied = false;
+    for (Room room : snapshot.agents.room) {
+        packet.westDoorOccupied |= room == Room::WestDoor;
+        packet.eastDoorOccupied |= room == Room::EastDoor;
+    }
+}
+
+void GameplayState::executeAudio() {
+    auto& audio = Engine::AudioSystem::getInstance();
+    for (const AudioCommand& command : audioCommands) {
+        switch (command.type) {
+            case AudioCommandType::PlaySound: audio.playSound(command.name); break;
+            case AudioCommandType::StopSound: audio.stopSound(command.name); break;
+            case AudioCommandType::Position: audio.updateVirtualPosition(command.name, command.angle); break;
+        }
+    }
+    audioCommands.clear();
+}
+
+void GameplayState::finishNight() {
+    bool survived = snapshot.outcome == Engine::NightOutcome::Survived;
+    TSS_LOG_INFO("GameplayState", "Night over", Engine::field("survived", survived),
+                 Engine::field("time", snapshot.time));
+    auto& audio = Engine::AudioSystem::getInstance();
+    const char* endSound = survived ? CHIMES_SOUND : JUMPSCARE_SOUND;
+    if (audio.hasSound(endSound)) {
+        audio.playSound(endSound);
+    }
+
+    // Written on the save thread; the frame does not wait for the disk
+    auto& saves = Engine::SaveSystem::getInstance();
+    Engine::SaveData& save = saves.edit();
+    ++save.nightsPlayed;
+    save.playTime += snapshot.time;
+    if (snapshot.powerOut) {
+        ++save.powerOuts;
+    }
+    if (survived) {
+        ++save.nightsSurvived;
+        save.highestNight = std::max(save.highestNight, static_cast<std::uint32_t>(night));
+        save.night = std::max(save.night, static_cast<std::uint32_t>(night + 1));
+    } else {
+        auto killer = static_cast<std::size_t>(session.getKiller());
+        if (killer < Engine::ANIMATRONIC_KIND_COUNT) {
+            ++save.deaths[killer];
+        }
+    }
+    saves.save();
+
+    endTimer = Engine::TimerWheel::getInstance().schedule(END_DELAY, [] {
+        // init() stopped the menu music; the intro is not replayed
+        Engine::AudioSystem::getInstance().playMusic("menu-loop");
+        StateManager::getInstance().changeState(std::make_unique<MainMenuState>());
+    });
+}
+
+void GameplayState::draw(sf::RenderTarget&) {
+    try {
+        auto& renderQueue = Engine::RenderQueue::getInstance();
+        renderQueue.setClearColor(sf::Color(10, 10, 14));
+
+        const bool cameraOn = packet.devices[deviceIndex(PowerDevice::Camera)];
+        auto& cameras = Engine::CameraSystem::getInstance();
+        cameras.setMonitorOpen(cameraOn);
+        if (cameraOn) {
+            cameras.render();
+            cameras.submit(toScreen(0.0f, 0.0f, 1.0f, 1.0f));
+        } else {
+            // Office: doors, and whoever stands in a lit doorway
+            const sf::Color doorColor(60, 60, 66);
+            const sf::Color figureColor(90, 70, 40);
+            if (packet.devices[deviceIndex(PowerDevice::LeftDoor)]) {
+                renderQueue.submitRect(toScreen(0.0f, 0.1f, 0.12f, 0.8f), doorColor, Engine::RenderLayer::Scene);
+            } else if (packet.devices[deviceIndex(PowerDevice::LeftLight)] && packet.westDoorOccupied) {
+                renderQueue.submitRect(toScreen(0.03f, 0.3f, 0.06f, 0.6f), figureColor, Engine::RenderLayer::Scene);
+            }
+            if (packet.devices[deviceIndex(PowerDevice::RightDoor)]) {
+                renderQueue.submitRect(toScreen(0.88f, 0.1f, 0.12f, 0.8f), doorColor, Engine::RenderLayer::Scene);
+            } else if (packet.devices[deviceIndex(PowerDevice::RightLight)] && packet.eastDoorOccupied) {
+                renderQueue.submitRect(toScreen(0.91f, 0.3f, 0.06f, 0.6f), figureColor, Engine::RenderLayer::Scene);
+            }
+
+            auto& flashlight = Engine::FlashlightSystem::getInstance();
+            flashlight.clearLights();
+            flashlight.setFlashlight(!packet.powerOut);
+            flashlight.setFlashlightPosition(packet.cursor);
+            const sf::Color doorLight(255, 240, 200);
+            if (packet.devices[deviceIndex(PowerDevice::LeftLight)]) {
+                flashlight.addLight({ sf::Vector2f(0.06f, 0.5f), 260.0f, doorLight });
+            }
+            if (packet.devices[deviceIndex(PowerDevice::RightLight)]) {
+                flashlight.addLight({ sf::Vector2f(0.94f, 0.5f), 260.0f, doorLight });
+            }
+            if (flashlight.render()) {
+                flashlight.submit();
+            }
+        }
+
+        // HUD: power bar, usage pips and the hour
+        const sf::Color hudColor(200, 220, 200);
+        float powerFraction = packet.power / Engine::BreakerSystem::FULL_POWER;
+        renderQueue.submitRect(toScreen(0.03f, 0.88f, 0.2f * powerFraction, 0.02f), hudColor, Engine::RenderLayer::UI);
+        for (int bar = 0; bar < packet.usage; ++bar) {
+            sf::Color color = bar < 2 ? hudColor : (bar < 4 ? sf::Color(220, 200, 80) : sf::Color(220, 70, 60));
+            renderQueue.submitRect(toScreen(0.03f + 0.025f * bar, 0.92f, 0.02f, 0.03f), color, Engine::RenderLayer::UI);
+        }
+        for (int hour = 0; hour <= packet.hour; ++hour) {
+            renderQueue.submitRect(toScreen(0.82f + 0.025f * hour, 0.04f, 0.02f, 0.02f), hudColor, Engine::RenderLayer::UI);
+        }
+        clockText.setNumber("", packet.hour == 0 ? 12 : packet.hour, " AM");
+        clockText.submit();
+        nightText.submit();
+        powerText.setNumber("Power left: ", std::lround(powerFraction * 100.0f), "%");
+        powerText.submit();
+    } catch (const std::exception& e) {
+        std::cerr << "GameplayState: Error during draw: " << e.what() << std::endl;
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "GameState.hpp"
+#include "../core/TimerWheel.hpp"
+#include "../systems/simulation/NightSession.hpp"
+#include "../systems/ui/CachedText.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// The night as the previous frame left it. Written once per frame after the
+// update jobs have joined and read-only while they run.
+struct GameplaySnapshot {
+    Engine::AgentData agents;
+    std::array<bool, Engine::POWER_DEVICE_COUNT> devices{};
+    Engine::Room watchedRoom = Engine::Room::ShowStage;
+    Engine::NightOutcome outcome = Engine::NightOutcome::Running;
+    float time = 0.0f;
+    float power = Engine::BreakerSystem::FULL_POWER;
+    int usage = 1;
+    bool powerOut = false;
+};
+
+// Everything draw() needs; draw() never looks at the session
+struct GameplayRenderPacket {
+    std::array<bool, Engine::POWER_DEVICE_COUNT> devices{};
+    bool westDoorOccupied = false;
+    bool eastDoorOccupied = false;
+    bool powerOut = false;
+    float power = Engine::BreakerSystem::FULL_POWER;
+    int usage = 1;
+    int hour = 0;                 // 0 = 12 AM ... 6 = 6 AM
+    sf::Vector2f cursor;          // Normalized
+};
+
+enum class AudioCommandType : std::uint8_t {
+    PlaySound,
+    StopSound,
+    Position
+};
+
+// Produced on the audio job, executed on the main thread
+struct AudioCommand {
+    AudioCommandType type;
+    const char* name;
+    float angle;                  // Position only
+};
+
+// Player input gathered by handleInput() and applied before the update jobs
+struct GameplayInput {
+    bool toggleLeftDoor = false;
+    bool toggleRightDoor = false;
+    bool toggleMonitor = false;
+    bool leftLight = false;
+    bool rightLight = false;
+    Engine::Room selectFeed = Engine::Room::Count;
+    sf::Vector2f cursor;
+};
+
+// The night itself. update() runs in three steps:
+//  1. input is applied to the session (main thread)
+//  2. the simulation (AI and power), audio command generation and camera
+//     occupancy run as jobs on the JobSystem; all but the simulation read
+//     only the previous frame's snapshot, and each writes only its own
+//     output
+//  3. after the join, a new snapshot and the render packet are taken and
+//     the audio commands are executed (main thread)
+// draw() is single-threaded and only reads the render packet.
+class GameplayState : public GameState {
+public:
+    explicit GameplayState(int night = 1);
+    virtual ~GameplayState();
+
+    void init() override;
+    void cleanup() override;
+    void handleInput(sf::RenderWindow& window) override;
+    void update(float deltaTime) override;
+    void draw(sf::RenderTarget& target) override;
+
+    // AI levels for nights 1-7; later nights use the last entry
+    static Engine::NightSettings settingsForNight(int night);
+
+private:
+    void applyInput();
+    void generateAudio();
+    void updateCameras();
+    void takeSnapshot();
+    void buildRenderPacket();
+    void executeAudio();
+    void finishNight();
+
+    int night;
+    Engine::NightSession session;
+
+    GameplayInput input;
+    std::array<bool, 3> heldKeys{};       // Q, E, Space last frame
+    bool monitorOpen;
+
+    GameplaySnapshot snapshot;
+    GameplayRenderPacket packet;
+
+    // Audio job state: what the player has already heard
+    std::vector<Engine::Room> heardRooms;
+    std::array<bool, Engine::POWER_DEVICE_COUNT> heardDevices{};
+    bool heardPowerOut;
+    std::vector<AudioCommand> audioCommands;
+
+    Engine::TimerHandle endTimer;
+
+    // HUD text, rebuilt only when the values change
+    Engine::CachedText clockText;
+    Engine::CachedText nightText;
+    Engine::CachedText powerText;
+};
@@ -2,25 +2,24 @@
 #include "../config/AssetPaths.hpp"
 #include "../systems/animation/AnimationManager.hpp"
 #include "../systems/ui/ScalingManager.hpp"
+#include "../systems/render/RenderQueue.hpp"
 #include "../ui/MenuManager.hpp"
 #include "../systems/audio_systems/AudioSystem.hpp"
+#include "../core/SaveSystem.hpp"
 #include "../core/StateManager.hpp"
+#include "../core/Logger.hpp"
+#include "../resources/ResourceManager.hpp"
 #include "OptionsState.hpp"
+#include "GameplayState.hpp"
 #include <iostream>
-#include <filesystem>
-#include <fstream>
 #include <nlohmann/json.hpp>
 
 MainMenuState::MainMenuState() : lastHoveredButton("") {
-    std::cout << "MainMenuState: Constructor called" << std::endl;
-    
     // Verify audio system initialization
     auto& audio = Engine::AudioSystem::getInstance();
     try {
-        if (audio.getSoundStatus("menu-hover") == sf::SoundSource::Stopped) {
-            std::cout << "MainMenuState: Audio system initialized and menu-hover sound is loaded" << std::endl;
-        } else {
-            std::cout << "MainMenuState: Warning - Unexpected menu-hover sound status" << std::endl;
+        if (audio.getSoundStatus("menu-hover") != sf::SoundSource::Stopped) {
+            TSS_LOG_WARN("MainMenuState", "Unexpected menu-hover sound status");
         }
     } catch (const std::exception& e) {
         std::cerr << "MainMenuState: Error checking audio system - " << e.what() << std::endl;
@@ -34,15 +33,12 @@ MainMenuState::MainMenuState() : lastHoveredButton("") {
 
 void MainMenuState::loadMenuTextPlacement() {
     // Load menu text placement from config
-    std::ifstream file(AssetPaths::MENU_CONFIG);
-    if (!file.is_open()) {
+    nlohmann::json j;
+    if (!Engine::ResourceManager::getInstance().loadJson(j, AssetPaths::MENU_CONFIG)) {
         std::cerr << "MainMenuState: Failed to open menu configuration file!" << std::endl;
         return;
     }
 
-    nlohmann::json j;
-    file >> j;
-
     // Get the menu text placement
     const auto& placement = j["button_placement"][0];
     menuTextPlacement.position = sf::Vector2f(placement["x"].get<float>(), placement["y"].get<float>());
@@ -53,13 +49,13 @@ void MainMenuState::loadMenuTextPlacement() {
 }
 
 void MainMenuState::init() {
-    std::cout << "MainMenuState: Initializing..." << std::endl;
+    TSS_LOG_DEBUG("MainMenuState", "Initializing");
     
     // Set current state in MenuManager
     MenuManager::getInstance().setCurrentState("MainMenu");
     
     // Load menu text texture
-    if (!menuTextTexture.loadFromFile(AssetPaths::MENU_TEXT_TEXTURE)) {
+    if (!Engine::ResourceManager::getInstance().loadTexture(menuTextTexture, AssetPaths::MENU_TEXT_TEXTURE)) {
         std::cerr << "MainMenuState: Failed to load menu text texture!" << std::endl;
         return;
     }
@@ -67,7 +63,7 @@ void MainMenuState::init() {
     auto& animManager = AnimationManager::getInstance();
     
     try {
-        if (!std::filesystem::exists(AssetPaths::MAIN_MENU_ANIM)) {
+        if (!Engine::VirtualFileSystem::getInstance().isDirectory(AssetPaths::MAIN_MENU_ANIM)) {
             std::cerr << "MainMenuState: Animation directory does not exist: " << AssetPaths::MAIN_MENU_ANIM << std::endl;
             return;
         }
@@ -78,9 +74,6 @@ void MainMenuState::init() {
         }
         
         if (animManager.loadAnimation("main_menu", AssetPaths::MAIN_MENU_ANIM)) {
-            std::cout << "MainMenuState: Successfully loaded main menu animation from: " 
-                      << AssetPaths::MAIN_MENU_ANIM << std::endl;
-            
             if (auto* anim = animManager.getAnimation("main_menu")) {
                 if (!anim->hasFrames()) {
                     std::cerr << "MainMenuState: Animation loaded but contains no frames!" << std::endl;
@@ -117,6 +110,18 @@ void MainMenuState::handleInput(sf::RenderWindow& window) {
     
     // Handle button clicks
     if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
+        if (currentHoveredButton == "NEW_GAME") {
+            auto& saves = Engine::SaveSystem::getInstance();
+            saves.edit().night = 1;
+            saves.save();
+            StateManager::getInstance().changeState(std::make_unique<GameplayState>(1));
+            return;
+        }
+        if (currentHoveredButton == "CONTINUE") {
+            int night = static_cast<int>(Engine::SaveSystem::getInstance().get().night);
+            StateManager::getInstance().changeState(std::make_unique<GameplayState>(night));
+            return;
+        }
         if (currentHoveredButton == "OPTIONS") {
             // Save current music state and transition to options
             auto& audio = Engine::AudioSystem::getInstance();
@@ -136,22 +141,18 @@ void MainMenuState::handleInput(sf::RenderWindow& window) {
 
 void MainMenuState::update(float deltaTime) {
     try {
-        static float timeAccumulator = 0.0f;
-        timeAccumulator += deltaTime;
-        
         float cappedDeltaTime = std::min(deltaTime, 0.1f);
         
         AnimationManager::getInstance().update(cappedDeltaTime);
-        
-        timeAccumulator = 0.0f;
     } catch (const std::exception& e) {
         std::cerr << "MainMenuState: Error during update: " << e.what() << std::endl;
     }
 }
 
-void MainMenuState::draw(sf::RenderWindow& window) {
+void MainMenuState::draw(sf::RenderTarget& target) {
     try {
-        window.clear(sf::Color::Black);
+        auto& renderQueue = Engine::RenderQueue::getInstance();
+        renderQueue.setClearColor(sf::Color::Black);
         
         if (auto* anim = AnimationManager::getInstance().getAnimation("main_menu")) {
             if (!anim->hasFrames()) {
@@ -159,20 +160,20 @@ void MainMenuState::draw(sf::RenderWindow& window) {
                 return;
             }
             
+            auto& scalingManager = Engine::ScalingManager::getInstance();
+            anim->setTargetSize(target.getSize());
             sf::Sprite& sprite = anim->getCurrentFrame();
             
-            Engine::ScalingManager::getInstance().scaleSpriteToFill(sprite);
-            
-            window.draw(sprite);
+            scalingManager.scaleSpriteToFill(sprite, backgroundScale);
+            renderQueue.submit(sprite, Engine::RenderLayer::Background, anim->getCurrentShader());
             
             // Draw menu text at its configured position
-            auto& scalingManager = Engine::ScalingManager::getInstance();
-            scalingManager.scaleSprite(menuTextSprite, menuTextPlacement.normalizedPosition);
-            window.draw(menuTextSprite);
+            scalingManager.scaleSprite(menuTextSprite, menuTextPlacement.normalizedPosition, menuTextScale);
+            renderQueue.submit(menuTextSprite, Engine::RenderLayer::UI);
         }
         
         // Draw menu hitboxes and selector
-        MenuManager::getInstance().draw(window);
+        MenuManager::getInstance().draw(target);
     } catch (const std::exception& e) {
         std::cerr << "MainMenuState: Error during draw: " << e.what() << std::endl;
     }
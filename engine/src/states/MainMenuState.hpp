@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GameState.hpp"
+#include "../systems/ui/ScalingManager.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 
@@ -18,7 +19,7 @@ public:
     void cleanup() override;
     void handleInput(sf::RenderWindow& window) override;
     void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target) override;
 
 private:
     void loadMenuTextPlacement();
@@ -26,5 +27,7 @@ private:
     sf::Texture menuTextTexture;
     sf::Sprite menuTextSprite;
     MenuTextPlacement menuTextPlacement;
+    Engine::ScaleCache backgroundScale;
+    Engine::ScaleCache menuTextScale;
     std::string lastHoveredButton; // Track the last hovered button to avoid sound spam
 };
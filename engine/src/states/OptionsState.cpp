@@ -1,33 +1,46 @@
 #include "OptionsState.hpp"
+#include "../core/SaveSystem.hpp"
 #include "../core/StateManager.hpp"
+#include "../core/Logger.hpp"
 #include "MainMenuState.hpp"
 #include "../systems/animation/AnimationManager.hpp"
 #include "../systems/ui/ScalingManager.hpp"
+#include "../systems/render/RenderQueue.hpp"
 #include "../config/AssetPaths.hpp"
 #include "../ui/MenuManager.hpp"
+#include "../systems/audio_systems/AudioSystem.hpp"
+#include "../resources/ResourceManager.hpp"
 #include <iostream>
 #include <cmath>
-#include <fstream>
 #include <nlohmann/json.hpp>
+#include <algorithm>
+
+namespace {
+    // Volume change per click, in percent
+    constexpr float VOLUME_STEP = 10.0f;
+}
 
 OptionsState::OptionsState() 
     : backgroundColor(sf::Color(8, 16, 123)) // #08107b
     , isTransitioningIn(true)
     , isTransitioningOut(false)
-    , transitionTime(0.0f)
     , transitionDuration(1.0f)
     , currentAnimation("options_enter")
-    , animationComplete(false) {
+    , animationComplete(false)
+    , mouseWasDown(false) {
     init();
 }
 
+OptionsState::~OptionsState() {
+    Engine::TimerWheel::getInstance().cancel(transitionTimer);
+}
+
 void OptionsState::loadUIPlacement() {
     // Load menu config for UI element placement
-    std::ifstream configFile(AssetPaths::MENU_CONFIG);
-    if (!configFile.is_open()) {
+    nlohmann::json config;
+    if (!Engine::ResourceManager::getInstance().loadJson(config, AssetPaths::MENU_CONFIG)) {
         throw std::runtime_error("Failed to open menu config file");
     }
-    nlohmann::json config = nlohmann::json::parse(configFile);
 
     // Position UI elements according to menu config
     auto& placements = config["button_placement"];
@@ -50,9 +63,10 @@ void OptionsState::loadUIPlacement() {
 }
 
 void OptionsState::init() {
-    std::cout << "OptionsState: Initializing..." << std::endl;
+    TSS_LOG_DEBUG("OptionsState", "Initializing");
     
     auto& animManager = AnimationManager::getInstance();
+    auto& resources = Engine::ResourceManager::getInstance();
     
     try {
         // Set current state in MenuManager
@@ -60,8 +74,6 @@ void OptionsState::init() {
         
         // Load the options-enter animation
         if (animManager.loadAnimation("options_enter", AssetPaths::OPTIONS_ENTER_ANIM, false)) {
-            std::cout << "OptionsState: Successfully loaded options enter animation" << std::endl;
-            
             if (auto* anim = animManager.getAnimation("options_enter")) {
                 anim->setMaxLoadedFrames(60);  // 2 seconds at 30 FPS
                 anim->setFrameTime(1.0f/30.0f);  // 30 FPS
@@ -79,24 +91,22 @@ void OptionsState::init() {
         }
         
         // Also load the exit animation but don't play it yet
-        if (animManager.loadAnimation("options_exit", AssetPaths::OPTIONS_EXIT_ANIM, false)) {
-            std::cout << "OptionsState: Successfully loaded options exit animation" << std::endl;
-        } else {
+        if (!animManager.loadAnimation("options_exit", AssetPaths::OPTIONS_EXIT_ANIM, false)) {
             std::cerr << "OptionsState: Failed to load options exit animation!" << std::endl;
         }
 
         // Load UI textures
-        if (!optionsButtonsTexture.loadFromFile(AssetPaths::OPTIONS_BUTTONS_TEXTURE)) {
+        if (!resources.loadTexture(optionsButtonsTexture, AssetPaths::OPTIONS_BUTTONS_TEXTURE)) {
             std::cerr << "OptionsState: Failed to load options buttons texture!" << std::endl;
         }
         optionsButtonsSprite.setTexture(optionsButtonsTexture);
 
-        if (!resetGameButtonTexture.loadFromFile(AssetPaths::RESET_ALL_PROGRESS_TEXTURE)) {
+        if (!resources.loadTexture(resetGameButtonTexture, AssetPaths::RESET_ALL_PROGRESS_TEXTURE)) {
             std::cerr << "OptionsState: Failed to load reset game button texture!" << std::endl;
         }
         resetGameButtonSprite.setTexture(resetGameButtonTexture);
 
-        if (!checkTexture.loadFromFile(AssetPaths::UI_CHECK)) {
+        if (!resources.loadTexture(checkTexture, AssetPaths::UI_CHECK)) {
             std::cerr << "OptionsState: Failed to load check texture!" << std::endl;
         }
         checkSprite.setTexture(checkTexture);
@@ -123,6 +133,22 @@ void OptionsState::cleanup() {
 }
 
 void OptionsState::handleInput(sf::RenderWindow& window) {
+    // Buttons act once per click, not every frame the mouse is held
+    bool mouseDown = sf::Mouse::isButtonPressed(sf::Mouse::Left);
+    bool clicked = mouseDown && !mouseWasDown;
+    mouseWasDown = mouseDown;
+
+    if (clicked && !isTransitioningOut && animationComplete) {
+        auto& menu = MenuManager::getInstance();
+        for (const char* name : { "SFX_VOL_DOWN_BUTTON", "SFX_VOL_UP_BUTTON", "MUSIC_VOL_DOWN_BUTTON",
+                                  "MUSIC_VOL_UP_BUTTON", "RESET_ALL_PROGRESS_BUTTON" }) {
+            if (menu.isHitboxClicked(name, window)) {
+                handleButton(name);
+                break;
+            }
+        }
+    }
+
     if (!isTransitioningOut && animationComplete) {
         if (sf::Keyboard::isKeyPressed(sf::Keyboard::Escape) || 
             (sf::Mouse::isButtonPressed(sf::Mouse::Left) && 
@@ -133,6 +159,11 @@ void OptionsState::handleInput(sf::RenderWindow& window) {
             if (auto* anim = AnimationManager::getInstance().getAnimation("options_exit")) {
                 anim->reset();
                 anim->play();
+            } else {
+                // No exit animation to wait for
+                transitionTimer = Engine::TimerWheel::getInstance().schedule(transitionDuration, [] {
+                    StateManager::getInstance().changeState(std::make_unique<MainMenuState>());
+                });
             }
             
             // Clear all sprites and hitboxes
@@ -144,6 +175,26 @@ void OptionsState::handleInput(sf::RenderWindow& window) {
     }
 }
 
+void OptionsState::handleButton(const std::string& name) {
+    auto& saves = Engine::SaveSystem::getInstance();
+    Engine::SaveData& save = saves.edit();
+    auto& audio = Engine::AudioSystem::getInstance();
+
+    if (name == "RESET_ALL_PROGRESS_BUTTON") {
+        saves.resetProgress();
+        TSS_LOG_INFO("OptionsState", "Progress reset");
+    } else if (name.rfind("SFX_", 0) == 0) {
+        float step = name == "SFX_VOL_UP_BUTTON" ? VOLUME_STEP : -VOLUME_STEP;
+        save.sfxVolume = std::clamp(save.sfxVolume + step, 0.0f, 100.0f);
+        audio.setCategoryVolume("sfx", save.sfxVolume);
+    } else {
+        float step = name == "MUSIC_VOL_UP_BUTTON" ? VOLUME_STEP : -VOLUME_STEP;
+        save.musicVolume = std::clamp(save.musicVolume + step, 0.0f, 100.0f);
+        audio.setCategoryVolume("music", save.musicVolume);
+    }
+    saves.save();
+}
+
 void OptionsState::update(float deltaTime) {
     try {
         auto& animManager = AnimationManager::getInstance();
@@ -168,35 +219,37 @@ void OptionsState::update(float deltaTime) {
     }
 }
 
-void OptionsState::draw(sf::RenderWindow& window) {
+void OptionsState::draw(sf::RenderTarget& target) {
     try {
+        auto& renderQueue = Engine::RenderQueue::getInstance();
+        auto& scalingManager = Engine::ScalingManager::getInstance();
+        
         // Clear with the options menu background color
-        window.clear(backgroundColor);
+        renderQueue.setClearColor(backgroundColor);
         
         // Only draw animation during transitions (not complete) or when transitioning out
         if (!animationComplete || isTransitioningOut) {
             if (auto* anim = AnimationManager::getInstance().getAnimation(currentAnimation)) {
                 if (anim->hasFrames()) {
+                    anim->setTargetSize(target.getSize());
                     sf::Sprite& sprite = anim->getCurrentFrame();
-                    Engine::ScalingManager::getInstance().scaleSpriteToFill(sprite);
-                    window.draw(sprite);
+                    scalingManager.scaleSpriteToFill(sprite, animationScale);
+                    renderQueue.submit(sprite, Engine::RenderLayer::Background, anim->getCurrentShader());
                 }
             }
         } else {
-            auto& scalingManager = Engine::ScalingManager::getInstance();
-            
             // Scale and position UI elements
-            scalingManager.scaleSprite(optionsButtonsSprite, optionsButtonsPlacement.normalizedPosition);
-            scalingManager.scaleSprite(resetGameButtonSprite, resetGameButtonPlacement.normalizedPosition);
-            scalingManager.scaleSprite(checkSprite, checkPlacement.normalizedPosition);
+            scalingManager.scaleSprite(optionsButtonsSprite, optionsButtonsPlacement.normalizedPosition, optionsButtonsScale);
+            scalingManager.scaleSprite(resetGameButtonSprite, resetGameButtonPlacement.normalizedPosition, resetGameButtonScale);
+            scalingManager.scaleSprite(checkSprite, checkPlacement.normalizedPosition, checkScale);
             
             // Draw UI elements
-            window.draw(optionsButtonsSprite);
-            window.draw(resetGameButtonSprite);
-            window.draw(checkSprite);
+            renderQueue.submit(optionsButtonsSprite, Engine::RenderLayer::UI);
+            renderQueue.submit(resetGameButtonSprite, Engine::RenderLayer::UI);
+            renderQueue.submit(checkSprite, Engine::RenderLayer::UIOverlay);
 
             // Draw hitboxes through MenuManager
-            MenuManager::getInstance().draw(window);
+            MenuManager::getInstance().draw(target);
         }
         
     } catch (const std::exception& e) {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "GameState.hpp"
+#include "../systems/ui/ScalingManager.hpp"
+#include "../core/TimerWheel.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 
@@ -12,26 +14,30 @@ struct OptionsUIPlacement {
 class OptionsState : public GameState {
 public:
     OptionsState();
-    virtual ~OptionsState() = default;
+    virtual ~OptionsState();
     
     void init() override;
     void cleanup() override;
     void handleInput(sf::RenderWindow& window) override;
     void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target) override;
+    // Once the enter animation is done the menu only changes on input
+    bool isStatic() const override { return animationComplete && !isTransitioningOut; }
 
 private:
     void loadUIPlacement();
+    void handleButton(const std::string& name);
     
     sf::Color backgroundColor;
     bool isTransitioningIn;
     bool isTransitioningOut;
-    float transitionTime;
-    float transitionDuration;
+    float transitionDuration;             // Fallback exit delay without the exit animation
+    Engine::TimerHandle transitionTimer;
     
     // Animation related
     std::string currentAnimation;
     bool animationComplete;
+    bool mouseWasDown;
 
     // UI Elements
     sf::Texture optionsButtonsTexture;
@@ -45,4 +51,10 @@ private:
     OptionsUIPlacement optionsButtonsPlacement;
     OptionsUIPlacement resetGameButtonPlacement;
     OptionsUIPlacement checkPlacement;
+    
+    // Cached sprite transforms
+    Engine::ScaleCache animationScale;
+    Engine::ScaleCache optionsButtonsScale;
+    Engine::ScaleCache resetGameButtonScale;
+    Engine::ScaleCache checkScale;
 }; 
\ No newline at end of file
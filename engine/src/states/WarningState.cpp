@@ -1,8 +1,11 @@
 #include "WarningState.hpp"
 #include "../core/StateManager.hpp"
+#include "../core/Logger.hpp"
 #include "MainMenuState.hpp"
 #include "../systems/ui/ScalingManager.hpp"
+#include "../systems/render/RenderQueue.hpp"
 #include "../config/AssetPaths.hpp"
+#include "../resources/ResourceManager.hpp"
 #include <iostream>
 #include <cmath>
 
@@ -11,7 +14,7 @@ WarningState::WarningState() : startFade(false), hasTransitioned(false), opacity
 }
 
 void WarningState::init() {
-    if (!warningTexture.loadFromFile(AssetPaths::WARNING_TEXTURE)) {
+    if (!Engine::ResourceManager::getInstance().loadTexture(warningTexture, AssetPaths::WARNING_TEXTURE)) {
         throw std::runtime_error("Failed to load warning texture");
     }
     warningSprite.setTexture(warningTexture);
@@ -19,7 +22,16 @@ void WarningState::init() {
         warningTexture.getSize().x / 2.f,
         warningTexture.getSize().y / 2.f
     );
-    timer.restart();
+    fadeTimer = Engine::TimerWheel::getInstance().schedule(fadeTime, [this] {
+        if (!startFade) {
+            startFade = true;
+            TSS_LOG_DEBUG("WarningState", "Fade started by timeout", Engine::field("seconds", fadeTime));
+        }
+    });
+}
+
+WarningState::~WarningState() {
+    Engine::TimerWheel::getInstance().cancel(fadeTimer);
 }
 
 void WarningState::cleanup() {
@@ -28,17 +40,11 @@ void WarningState::cleanup() {
 void WarningState::handleInput(sf::RenderWindow& window) {
     if (!startFade && sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
         startFade = true;
-        std::cout << "WarningState: User input received, starting fade" << std::endl;
+        TSS_LOG_DEBUG("WarningState", "Fade started by input");
     }
 }
 
 void WarningState::update(float deltaTime) {
-    // Check if it's time to start fading
-    if (!startFade && timer.getElapsedTime().asSeconds() >= fadeTime) {
-        startFade = true;
-        std::cout << "WarningState: Auto-fade starting after " << fadeTime << " seconds" << std::endl;
-    }
-    
     if (startFade && !hasTransitioned) {
         // Simple linear fade over 2 seconds
         opacity = std::max(0.0f, opacity - (128.0f * deltaTime));
@@ -56,12 +62,11 @@ void WarningState::update(float deltaTime) {
     }
 }
 
-void WarningState::draw(sf::RenderWindow& window) {
-    // Update ScalingManager with current window size
-    Engine::ScalingManager::getInstance().updateWindowSize(window.getSize().x, window.getSize().y);
+void WarningState::draw(sf::RenderTarget& target) {
+    auto& scalingManager = Engine::ScalingManager::getInstance();
     
-    // Scale the warning sprite to fill the screen
-    Engine::ScalingManager::getInstance().scaleSpriteToFill(warningSprite);
+    // Scale the warning sprite to fill the screen (only when the render size changed)
+    scalingManager.scaleSpriteToFill(warningSprite, warningScale);
     
-    window.draw(warningSprite);
+    Engine::RenderQueue::getInstance().submit(warningSprite, Engine::RenderLayer::Background);
 } 
\ No newline at end of file
@@ -1,23 +1,28 @@
 #pragma once
 
 #include "GameState.hpp"
+#include "../systems/ui/ScalingManager.hpp"
+#include "../core/TimerWheel.hpp"
 #include <SFML/Graphics.hpp>
 
 class WarningState : public GameState {
 public:
     WarningState();
-    virtual ~WarningState() = default;
+    virtual ~WarningState();
     
     void init() override;
     void cleanup() override;
     void handleInput(sf::RenderWindow& window) override;
     void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target) override;
+    // The fade only changes the sprite colour, which the render queue sees
+    bool isStatic() const override { return true; }
     
 private:
     sf::Texture warningTexture;
     sf::Sprite warningSprite;
-    sf::Clock timer;
+    Engine::ScaleCache warningScale;
+    Engine::TimerHandle fadeTimer;
     float opacity;
     float fadeTime = 5.0f;
     bool startFade = false;
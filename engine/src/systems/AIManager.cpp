@@ -0,0 +1,141 @@
+#include "AIManager.hpp"
+#include "../animatronics/Bonnie.hpp"
+#include "../animatronics/Chica.hpp"
+#include "../animatronics/Foxy.hpp"
+#include "../animatronics/Freddy.hpp"
+#include "../core/Logger.hpp"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+    // Spreads a seed so neighbouring agents get unrelated streams
+    std::uint32_t mixSeed(std::uint32_t value) {
+        value ^= value >> 16;
+        value *= 0x7feb352dU;
+        value ^= value >> 15;
+        value *= 0x846ca68bU;
+        value ^= value >> 16;
+        return value != 0 ? value : 0x9e3779b9U;
+    }
+}
+
+AIManager::AIManager(std::uint32_t seed)
+    : behaviours{ Freddy::behaviour(), Bonnie::behaviour(), Chica::behaviour(), Foxy::behaviour() }
+    , jobs(nullptr)
+    , seed(seed)
+    , accumulator(0.0f)
+{
+    const RoomGraph& building = RoomGraph::getBuilding();
+    for (std::size_t k = 0; k < ANIMATRONIC_KIND_COUNT; ++k) {
+        graphs[k] = building.restrictTo(behaviours[k].roomMask);
+    }
+}
+
+std::uint32_t AIManager::spawn(AnimatronicKind kind, int aiLevel) {
+    const Behaviour& behaviour = behaviours[index(kind)];
+    auto agent = static_cast<std::uint32_t>(agents.size());
+
+    agents.kind.push_back(kind);
+    agents.room.push_back(behaviour.startRoom);
+    agents.aiLevel.push_back(static_cast<std::uint8_t>(std::clamp(aiLevel, 0, MAX_AI_LEVEL)));
+    agents.movementTimer.push_back(behaviour.moveInterval);
+    agents.target.push_back(behaviour.target);
+    agents.phase.push_back(0);
+    agents.rng.push_back(mixSeed(seed * 0x9e3779b9U + agent));
+
+    TSS_LOG_TRACE("AIManager", "Spawned agent", field("name", behaviour.name),
+                  field("agent", agent), field("level", aiLevel));
+    return agent;
+}
+
+void AIManager::clear() {
+    agents = AgentData();
+    events.clear();
+    accumulator = 0.0f;
+}
+
+void AIManager::setAILevel(std::uint32_t agent, int aiLevel) {
+    if (agent >= agents.size()) {
+        return;
+    }
+    agents.aiLevel[agent] = static_cast<std::uint8_t>(std::clamp(aiLevel, 0, MAX_AI_LEVEL));
+}
+
+void AIManager::update(float deltaTime) {
+    accumulator += deltaTime;
+    while (accumulator >= FIXED_STEP) {
+        tick();
+        accumulator -= FIXED_STEP;
+    }
+}
+
+void AIManager::tick() {
+    const std::size_t count = agents.size();
+    const std::size_t chunkCount = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    if (chunks.size() < chunkCount) {
+        chunks.resize(chunkCount);
+    }
+
+    auto tickChunks = [this, count](std::size_t first, std::size_t last) {
+        for (std::size_t c = first; c < last; ++c) {
+            tickChunk(chunks[c], c * CHUNK_SIZE, std::min(count, (c + 1) * CHUNK_SIZE));
+        }
+    };
+    if (jobs != nullptr && chunkCount > 1) {
+        jobs->parallelFor(chunkCount, 1, tickChunks);
+    } else {
+        tickChunks(0, chunkCount);
+    }
+
+    for (std::size_t c = 0; c < chunkCount; ++c) {
+        auto& chunkEvents = chunks[c].events;
+        events.insert(events.end(), chunkEvents.begin(), chunkEvents.end());
+        chunkEvents.clear();
+    }
+}
+
+void AIManager::tickChunk(Chunk& chunk, std::size_t begin, std::size_t end) {
+    float* timers = agents.movementTimer.data();
+
+    // Straight pass over one array; the compiler vectorises this
+    for (std::size_t i = begin; i < end; ++i) {
+        timers[i] -= FIXED_STEP;
+    }
+
+    auto& due = chunk.due;
+    due.clear();
+    for (std::size_t i = begin; i < end; ++i) {
+        if (timers[i] <= 0.0f) {
+            due.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    if (due.empty()) {
+        return;
+    }
+
+    // Movement opportunity: succeeds when 1-20 rolls at or under the AI level
+    auto& movers = chunk.movers;
+    for (auto& list : movers) {
+        list.clear();
+    }
+    for (std::uint32_t agent : due) {
+        std::size_t k = index(agents.kind[agent]);
+        timers[agent] += behaviours[k].moveInterval;
+        std::uint32_t roll = nextRandom(agents.rng[agent], MAX_AI_LEVEL) + 1;
+        if (roll <= agents.aiLevel[agent]) {
+            movers[k].push_back(agent);
+        }
+    }
+
+    // One strategy call per character kind
+    for (std::size_t k = 0; k < ANIMATRONIC_KIND_COUNT; ++k) {
+        if (movers[k].empty()) {
+            continue;
+        }
+        MoveContext context{ agents, graphs[k], world, chunk.events };
+        behaviours[k].move(context, movers[k].data(), movers[k].size());
+    }
+}
+
+} // namespace Engine
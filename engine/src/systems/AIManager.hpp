@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../animatronics/Animatronic.hpp"
+#include "RoomGraph.hpp"
+#include "../core/JobSystem.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Runs the animatronics. State lives in AgentData (one array per field) and
+// is advanced in fixed steps: every step decrements all movement timers in
+// one pass, collects the agents whose opportunity came up, rolls 1-20
+// against their AI level and hands the winners to their character's
+// behaviour in one batch per kind.
+//
+// Agents are ticked in fixed chunks of CHUNK_SIZE. Behaviours only touch
+// their own agents, so with a JobSystem set the chunks run in parallel;
+// events are merged in chunk order, so results are the same whatever the
+// thread count.
+//
+// Not a singleton: the night simulator runs many managers side by side.
+class AIManager {
+public:
+    static constexpr float FIXED_STEP = 1.0f / 60.0f;
+    static constexpr int MAX_AI_LEVEL = 20;
+    static constexpr std::size_t CHUNK_SIZE = 1024;
+
+    explicit AIManager(std::uint32_t seed = 1);
+
+    // Adds an agent in its character's start room, returns its index
+    std::uint32_t spawn(AnimatronicKind kind, int aiLevel);
+    void clear();
+
+    void setAILevel(std::uint32_t agent, int aiLevel);
+    void setWorldState(const AIWorldState& state) { world = state; }
+
+    // Pool for ticking chunks in parallel; nullptr ticks on the calling thread
+    void setJobSystem(JobSystem* jobSystem) { jobs = jobSystem; }
+
+    // Accumulates real time and runs as many fixed steps as fit
+    void update(float deltaTime);
+    void tick();
+
+    const AgentData& getAgents() const { return agents; }
+    std::size_t getAgentCount() const { return agents.size(); }
+    const Behaviour& getBehaviour(AnimatronicKind kind) const { return behaviours[index(kind)]; }
+
+    // Moves, blocks and attacks since the last clearEvents()
+    const std::vector<AIEvent>& getEvents() const { return events; }
+    void clearEvents() { events.clear(); }
+
+private:
+    static std::size_t index(AnimatronicKind kind) { return static_cast<std::size_t>(kind); }
+
+    // Scratch lists for one chunk, reused every tick
+    struct Chunk {
+        std::vector<std::uint32_t> due;
+        std::array<std::vector<std::uint32_t>, ANIMATRONIC_KIND_COUNT> movers;
+        std::vector<AIEvent> events;
+    };
+
+    void tickChunk(Chunk& chunk, std::size_t begin, std::size_t end);
+
+    std::array<Behaviour, ANIMATRONIC_KIND_COUNT> behaviours;
+    std::array<RoomGraph, ANIMATRONIC_KIND_COUNT> graphs;
+
+    AgentData agents;
+    AIWorldState world;
+    std::vector<AIEvent> events;
+
+    std::vector<Chunk> chunks;
+    JobSystem* jobs;
+
+    std::uint32_t seed;
+    float accumulator;
+};
+
+} // namespace Engine
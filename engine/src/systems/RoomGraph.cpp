@@ -0,0 +1,99 @@
+#include "RoomGraph.hpp"
+#include <algorithm>
+
+namespace Engine {
+
+namespace {
+    // Walkable connections of the building, in both directions
+    const std::vector<std::pair<Room, Room>> BUILDING_EDGES = {
+        { Room::ShowStage, Room::DiningArea },
+        { Room::DiningArea, Room::Backstage },
+        { Room::DiningArea, Room::PirateCove },
+        { Room::DiningArea, Room::Restrooms },
+        { Room::DiningArea, Room::Kitchen },
+        { Room::DiningArea, Room::WestHall },
+        { Room::DiningArea, Room::EastHall },
+        { Room::Restrooms, Room::EastHall },
+        { Room::Kitchen, Room::EastHall },
+        { Room::PirateCove, Room::WestHall },
+        { Room::WestHall, Room::SupplyCloset },
+        { Room::WestHall, Room::WestHallCorner },
+        { Room::WestHall, Room::WestDoor },
+        { Room::SupplyCloset, Room::WestHallCorner },
+        { Room::WestHallCorner, Room::WestDoor },
+        { Room::EastHall, Room::EastHallCorner },
+        { Room::EastHallCorner, Room::EastDoor },
+        { Room::WestDoor, Room::Office },
+        { Room::EastDoor, Room::Office },
+    };
+}
+
+const RoomGraph& RoomGraph::getBuilding() {
+    static const RoomGraph building = [] {
+        RoomGraph graph;
+        graph.build(BUILDING_EDGES);
+        return graph;
+    }();
+    return building;
+}
+
+RoomGraph RoomGraph::restrictTo(std::uint32_t roomMask) const {
+    std::vector<std::pair<Room, Room>> kept;
+    for (const auto& edge : edgeList) {
+        if ((roomMask & roomBit(edge.first)) && (roomMask & roomBit(edge.second))) {
+            kept.push_back(edge);
+        }
+    }
+    RoomGraph graph;
+    graph.build(kept);
+    return graph;
+}
+
+void RoomGraph::build(const std::vector<std::pair<Room, Room>>& edges) {
+    edgeList = edges;
+
+    // Count degrees, prefix-sum into offsets, then scatter
+    std::array<std::uint16_t, ROOM_COUNT> degree{};
+    for (const auto& edge : edges) {
+        ++degree[index(edge.first)];
+        ++degree[index(edge.second)];
+    }
+    offsets[0] = 0;
+    for (std::size_t r = 0; r < ROOM_COUNT; ++r) {
+        offsets[r + 1] = static_cast<std::uint16_t>(offsets[r] + degree[r]);
+    }
+    neighbours.assign(offsets[ROOM_COUNT], Room::Count);
+    std::array<std::uint16_t, ROOM_COUNT> fill{};
+    for (const auto& edge : edges) {
+        std::size_t a = index(edge.first);
+        std::size_t b = index(edge.second);
+        neighbours[offsets[a] + fill[a]++] = edge.second;
+        neighbours[offsets[b] + fill[b]++] = edge.first;
+    }
+    for (std::size_t r = 0; r < ROOM_COUNT; ++r) {
+        std::sort(neighbours.begin() + offsets[r], neighbours.begin() + offsets[r + 1]);
+    }
+
+    // Breadth-first search from every room; the graph is tiny
+    for (std::size_t from = 0; from < ROOM_COUNT; ++from) {
+        auto& row = distances[from];
+        row.fill(UNREACHABLE);
+        row[from] = 0;
+        std::array<std::size_t, ROOM_COUNT> queue{};
+        std::size_t head = 0;
+        std::size_t tail = 0;
+        queue[tail++] = from;
+        while (head < tail) {
+            std::size_t current = queue[head++];
+            for (std::uint16_t i = offsets[current]; i < offsets[current + 1]; ++i) {
+                std::size_t next = index(neighbours[i]);
+                if (row[next] == UNREACHABLE) {
+                    row[next] = static_cast<std::uint8_t>(row[current] + 1);
+                    queue[tail++] = next;
+                }
+            }
+        }
+    }
+}
+
+} // namespace Engine
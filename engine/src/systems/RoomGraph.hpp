@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../animatronics/Animatronic.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Engine {
+
+// Room adjacency in compressed form: the neighbours of room r are
+// neighbours[offsets[r] .. offsets[r + 1]). Hop distances between all rooms
+// are computed once on construction, so behaviours never search at runtime.
+class RoomGraph {
+public:
+    RoomGraph() = default;   // No rooms connected
+
+    // The whole building
+    static const RoomGraph& getBuilding();
+
+    // Subgraph that only keeps rooms in `roomMask`
+    RoomGraph restrictTo(std::uint32_t roomMask) const;
+
+    const Room* neighboursBegin(Room room) const { return neighbours.data() + offsets[index(room)]; }
+    const Room* neighboursEnd(Room room) const { return neighbours.data() + offsets[index(room) + 1]; }
+    std::size_t neighbourCount(Room room) const { return offsets[index(room) + 1] - offsets[index(room)]; }
+
+    static constexpr std::uint8_t UNREACHABLE = 0xFF;
+    std::uint8_t distance(Room from, Room to) const { return distances[index(from)][index(to)]; }
+
+private:
+    static std::size_t index(Room room) { return static_cast<std::size_t>(room); }
+    void build(const std::vector<std::pair<Room, Room>>& edges);
+
+    std::array<std::uint16_t, ROOM_COUNT + 1> offsets{};
+    std::vector<Room> neighbours;
+    std::array<std::array<std::uint8_t, ROOM_COUNT>, ROOM_COUNT> distances{};
+    std::vector<std::pair<Room, Room>> edgeList;
+};
+
+} // namespace Engine
@@ -1,298 +1,197 @@
 #include "Animation.hpp"
-#include <filesystem>
+#include "../../core/Logger.hpp"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
-#include <numeric>
 
 Animation::Animation()
-    : frameTime(1.0f/30.0f)  // Default 30 FPS
+    : Animation(std::make_shared<FrameSource>())
+{
+}
+
+Animation::Animation(std::shared_ptr<FrameSource> frameSource)
+    : source(std::move(frameSource))
+    , frameTime(1.0f/30.0f)  // Default 30 FPS
     , currentTime(0.0f)
     , currentFrame(0)
+    , speed(1.0f)
     , playing(false)
     , isLooping(true)
-    , totalMemoryUsage(0)
-    , maxLoadedFrames(DEFAULT_MAX_FRAMES)
-    , isInitialLoad(true)
 {
-    std::cout << "Animation: Constructor called" << std::endl;
+    TSS_LOG_TRACE("Animation", "Constructed");
+    playhead = source->addPlayhead();
     currentSprite.setPosition(0, 0);
+
+    // Sharing an already loaded source: show where the playhead starts
+    if (source->hasFrames()) {
+        if (auto frame = source->getFrame(0)) {
+            showFrame(frame);
+            auto bounds = currentSprite.getLocalBounds();
+            currentSprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+        }
+    }
 }
 
 Animation::~Animation() {
-    std::cout << "Animation: Destructor called, cleaning up " << loadedFrames.size() << " frames" << std::endl;
-    std::lock_guard<std::recursive_mutex> lock(frameMutex);
-    loadedFrames.clear();
-    framePaths.clear();
-    currentTexture.reset();
-    std::cout << "Animation: All frames cleaned up" << std::endl;
+    TSS_LOG_TRACE("Animation", "Destroying");
+    source->removePlayhead(playhead);
+    currentFrameData.reset();
 }
 
 bool Animation::loadFromDirectory(const std::string& path, const std::string& extension) {
-    namespace fs = std::filesystem;
-    
-    try {
-        if (!fs::exists(path)) {
-            std::cerr << "Animation::loadFromDirectory: Directory does not exist: " << path << std::endl;
-            return false;
-        }
+    stop();
+    currentFrameData.reset();
 
-        if (!fs::is_directory(path)) {
-            std::cerr << "Animation::loadFromDirectory: Path is not a directory: " << path << std::endl;
-            return false;
-        }
-        
-        // Clear existing frames and reset state
-        {
-            std::cout << "Animation::loadFromDirectory: Clearing existing frames" << std::endl;
-            stop();
-            loadedFrames.clear();
-            framePaths.clear();
-            currentTexture.reset();
-            totalMemoryUsage = 0;
-            isInitialLoad = true;  // Set initial load flag
-        }
-        
-        // Get all files with matching extension
-        std::vector<fs::path> files;
-        for (const auto& entry : fs::directory_iterator(path)) {
-            if (entry.path().extension() == extension) {
-                files.push_back(entry.path());
-            }
-        }
-        
-        if (files.empty()) {
-            std::cerr << "Animation::loadFromDirectory: No files found with extension " << extension << " in " << path << std::endl;
-            return false;
-        }
-        
-        // Sort files by name to ensure correct sequence
-        std::sort(files.begin(), files.end());
-        
-        // Store paths
-        {
-            framePaths = std::move(files);
-        }
-        
-        std::cout << "Animation::loadFromDirectory: Found " << framePaths.size() << " frames" << std::endl;
-        
-        // Load initial frame to get dimensions
-        auto firstTexture = ensureFrameLoaded(0);
-        if (!firstTexture) {
-            std::cerr << "Animation::loadFromDirectory: Failed to load first frame" << std::endl;
-            return false;
-        }
-        
-        auto size = firstTexture->getSize();
-        std::cout << "Animation::loadFromDirectory: First frame size: " << size.x << "x" << size.y << std::endl;
-        
-        // Initial loading phase complete
-        isInitialLoad = false;
-        
-        return true;
-    } catch (const std::exception& e) {
-        std::cerr << "Animation::loadFromDirectory: Exception: " << e.what() << std::endl;
+    if (!source->loadFromDirectory(path, extension)) {
         return false;
     }
-}
 
-std::shared_ptr<sf::Texture> Animation::ensureFrameLoaded(size_t index) {
-    std::lock_guard<std::recursive_mutex> lock(frameMutex);
-    
-    if (index >= framePaths.size()) {
-        std::cerr << "Animation::ensureFrameLoaded: Invalid frame index: " << index << std::endl;
-        return nullptr;
+    // Set up the sprite from the first frame
+    auto frame = source->getFrame(0);
+    if (!frame) {
+        return false;
     }
-    
-    // First, check if we already have this frame
-    for (const auto& pair : loadedFrames) {
-        if (pair.first == index) {
-            return pair.second;
+    showFrame(frame);
+    auto bounds = currentSprite.getLocalBounds();
+    currentSprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+    return true;
+}
+
+void Animation::showFrame(const std::shared_ptr<AnimationFrame>& frame) {
+    if (frame->isYuv() && !yuvShader) {
+        yuvShader = FrameSource::createYuvShader();
+        if (!yuvShader) {
+            std::cerr << "Animation::showFrame: Failed to create YUV shader" << std::endl;
+            return;
         }
     }
-    
-    try {
-        // Create new texture
-        auto texture = std::make_shared<sf::Texture>();
-        if (!texture) {
-            std::cerr << "Animation::ensureFrameLoaded: Failed to allocate texture" << std::endl;
-            return nullptr;
-        }
-        
-        texture->setSmooth(true);
-        
-        if (!texture->loadFromFile(framePaths[index].string())) {
-            std::cerr << "Animation::ensureFrameLoaded: Failed to load texture: " << framePaths[index] << std::endl;
-            return nullptr;
-        }
-        
-        // Calculate memory usage
-        auto size = texture->getSize();
-        size_t frameMemory = size.x * size.y * 4;
-        
-        // Add to loaded frames
-        loadedFrames.push_back({index, texture});
-        totalMemoryUsage += frameMemory;
-        
-        // If this is the first frame ever loaded, set up the sprite
-        if (loadedFrames.size() == 1 && !currentTexture) {
-            currentTexture = texture;
-            currentSprite.setTexture(*texture, true);
-            auto bounds = currentSprite.getLocalBounds();
-            currentSprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-        }
-        
-        // Only maintain frame window if we're not in initial loading
-        if (!isInitialLoad) {
-            maintainFrameWindow();
-        }
-        
-        return texture;
-    } catch (const std::exception& e) {
-        std::cerr << "Animation::ensureFrameLoaded: Exception: " << e.what() << std::endl;
-        return nullptr;
+
+    currentFrameData = frame;
+    currentSprite.setTexture(*frame->texture);
+    currentSprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(frame->size.x), static_cast<int>(frame->size.y)));
+
+    if (frame->isYuv()) {
+        // The shader keeps pointers to the planes; currentFrameData keeps them alive
+        yuvShader->setUniform("chromaB", *frame->chromaB);
+        yuvShader->setUniform("chromaR", *frame->chromaR);
+        yuvShader->setUniform("lumaSize", sf::Glsl::Vec2(frame->texture->getSize()));
+        yuvShader->setUniform("chromaSize", sf::Glsl::Vec2(frame->chromaB->getSize()));
+        yuvShader->setUniform("chromaScale", 1.f / static_cast<float>(frame->chromaDivisor));
     }
 }
 
+const sf::Shader* Animation::getCurrentShader() const {
+    return currentFrameData && currentFrameData->isYuv() ? yuvShader.get() : nullptr;
+}
+
 bool Animation::loadFrame(size_t index) {
-    std::lock_guard<std::recursive_mutex> lock(frameMutex);
-    
-    if (index >= framePaths.size()) {
+    if (index >= source->getFrameCount()) {
         std::cerr << "Animation::loadFrame: Invalid frame index: " << index << std::endl;
         return false;
     }
-    
-    // Simply delegate to ensureFrameLoaded
-    return ensureFrameLoaded(index) != nullptr;
+
+    // Simply delegate to the source
+    return source->getFrame(index) != nullptr;
 }
 
-void Animation::maintainFrameWindow() {
-    // Calculate the window of frames we want to keep
-    size_t halfWindow = maxLoadedFrames / 2;
-    size_t windowStart = (currentFrame >= halfWindow) ? currentFrame - halfWindow : 0;
-    size_t windowEnd = std::min(windowStart + maxLoadedFrames, framePaths.size());
-    
-    // Create a new deque for the frames we want to keep
-    std::deque<std::pair<size_t, std::shared_ptr<sf::Texture>>> newFrames;
-    
-    // First, keep the current texture if it exists
-    if (currentTexture) {
-        for (const auto& pair : loadedFrames) {
-            if (pair.second == currentTexture) {
-                newFrames.push_back(pair);
-                break;
-            }
-        }
+void Animation::goToFrame(size_t index) {
+    currentFrame = index;
+    source->movePlayhead(playhead, currentFrame, isLooping);
+
+    auto frame = source->getFrame(currentFrame);
+    if (frame) {
+        showFrame(frame);
+    } else {
+        std::cerr << "Animation::update - Failed to load frame " << currentFrame << std::endl;
     }
-    
-    // Then add all frames within our window
-    for (const auto& pair : loadedFrames) {
-        if (pair.first >= windowStart && pair.first <= windowEnd) {
-            // Don't add the current texture again
-            if (!currentTexture || pair.second != currentTexture) {
-                newFrames.push_back(pair);
-            }
-        } else {
-            // Calculate memory to free
-            auto size = pair.second->getSize();
-            size_t frameMemory = size.x * size.y * 4;
-            totalMemoryUsage -= frameMemory;
-        }
+
+    // Upload the next frame now so its transfer overlaps with drawing this one
+    size_t frameCount = source->getFrameCount();
+    size_t nextFrame = currentFrame + 1;
+    if (nextFrame >= frameCount && isLooping) {
+        nextFrame = 0;
     }
-    
-    // If we still have too many frames, remove the ones furthest from current frame
-    while (newFrames.size() > maxLoadedFrames) {
-        // Find the frame furthest from current frame
-        auto furthestIt = newFrames.begin();
-        size_t maxDistance = 0;
-        
-        for (auto it = newFrames.begin(); it != newFrames.end(); ++it) {
-            if (it->second == currentTexture) continue;
-            
-            size_t distance = std::abs(static_cast<ptrdiff_t>(it->first) - static_cast<ptrdiff_t>(currentFrame));
-            if (distance > maxDistance) {
-                maxDistance = distance;
-                furthestIt = it;
-            }
-        }
-        
-        // If we couldn't find a frame to remove, break
-        if (maxDistance == 0) break;
-        
-        // Remove the frame
-        auto size = furthestIt->second->getSize();
-        size_t frameMemory = size.x * size.y * 4;
-        totalMemoryUsage -= frameMemory;
-        newFrames.erase(furthestIt);
+    if (nextFrame < frameCount) {
+        source->getFrame(nextFrame);
     }
-    
-    // Finally, swap in our new frame collection
-    loadedFrames.swap(newFrames);
 }
 
 void Animation::update(float deltaTime) {
-    if (!playing || framePaths.empty()) {
+    size_t frameCount = source->getFrameCount();
+    if (!playing || frameCount == 0) {
         return;
     }
-    
+
+    deltaTime *= speed;
     currentTime += deltaTime;
-    
+
     // Cap deltaTime to prevent huge frame jumps
     float maxDeltaTime = frameTime * 5.0f;  // Max 5 frame jump
     if (deltaTime > maxDeltaTime) {
         deltaTime = maxDeltaTime;
         currentTime = currentFrame * frameTime + deltaTime;
     }
-    
+
     size_t newFrame = static_cast<size_t>(currentTime / frameTime);
-    
-    if (newFrame >= framePaths.size()) {
+
+    if (newFrame >= frameCount) {
         if (isLooping) {
             currentTime = 0.0f;
             newFrame = 0;
         } else {
             playing = false;
-            newFrame = framePaths.size() - 1;
+            newFrame = frameCount - 1;
             return;
         }
     }
-    
+
     if (newFrame != currentFrame) {
-        currentFrame = newFrame;
-        auto texture = ensureFrameLoaded(currentFrame);
-        if (texture) {
-            currentTexture = texture;
-            currentSprite.setTexture(*currentTexture, true);
-        } else {
-            std::cerr << "Animation::update - Failed to load frame " << currentFrame << std::endl;
-        }
+        goToFrame(newFrame);
+    }
+}
+
+void Animation::seek(float time) {
+    size_t frameCount = source->getFrameCount();
+    if (frameCount == 0 || frameTime <= 0.0f) {
+        return;
+    }
+
+    float duration = frameCount * frameTime;
+    if (isLooping) {
+        time = std::fmod(std::max(time, 0.0f), duration);
+    } else {
+        time = std::min(std::max(time, 0.0f), duration - frameTime);
     }
+
+    currentTime = time;
+    size_t index = std::min(static_cast<size_t>(time / frameTime), frameCount - 1);
+    goToFrame(index);
 }
 
 sf::Sprite& Animation::getCurrentFrame() {
-    if (!currentTexture) {
+    if (!currentFrameData) {
         // Try to recover by loading current frame
-        auto texture = ensureFrameLoaded(currentFrame);
-        if (texture) {
-            currentTexture = texture;
-            currentSprite.setTexture(*currentTexture, true);
+        auto frame = source->getFrame(currentFrame);
+        if (frame) {
+            showFrame(frame);
         }
     }
-    
+
     return currentSprite;
 }
 
 void Animation::play() {
-    if (framePaths.empty()) {
+    if (!source->hasFrames()) {
         std::cerr << "Animation::play: Cannot play animation with no frames" << std::endl;
         return;
     }
-    
+
     // Ensure first frame is loaded
-    if (!ensureFrameLoaded(currentFrame)) {
+    if (!source->getFrame(currentFrame)) {
         std::cerr << "Animation::play: Failed to load initial frame" << std::endl;
         return;
     }
-    
+
     playing = true;
 }
 
@@ -302,11 +201,11 @@ void Animation::pause() {
 
 void Animation::stop() {
     playing = false;
-    currentFrame = 0;
-    currentTime = 0;
+    reset();
 }
 
 void Animation::reset() {
     currentFrame = 0;
     currentTime = 0;
-} 
\ No newline at end of file
+    source->movePlayhead(playhead, currentFrame, isLooping);
+}
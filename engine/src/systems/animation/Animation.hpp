@@ -1,52 +1,76 @@
 #pragma once
 
+#include "FrameSource.hpp"
 #include <SFML/Graphics.hpp>
-#include <filesystem>
-#include <deque>
 #include <memory>
-#include <mutex>
+#include <string>
 
+// A playhead over a FrameSource: its own time, speed, loop mode and sprite.
+// Several Animations can share one source (e.g. camera feeds showing the
+// same footage at different offsets) and the frames are decoded once.
 class Animation {
 public:
+    // Starts with a source of its own; loadFromDirectory() fills it
     Animation();
+    // Plays frames from an existing source
+    explicit Animation(std::shared_ptr<FrameSource> source);
     ~Animation();
-    
+
     bool loadFromDirectory(const std::string& path, const std::string& extension = ".jpg");
     bool loadFrame(size_t index);
     void update(float deltaTime);
     sf::Sprite& getCurrentFrame();
-    
+
+    // Shader the current frame must be drawn with, or null for RGBA frames
+    const sf::Shader* getCurrentShader() const;
+
     void play();
     void pause();
     void stop();
     void reset();
-    
+
+    // Jumps to `time` seconds into the animation
+    void seek(float time);
+
     bool isPlaying() const { return playing; }
-    bool hasFrames() const { return !framePaths.empty(); }
-    size_t getFrameCount() const { return framePaths.size(); }
-    
+    bool hasFrames() const { return source->hasFrames(); }
+    size_t getFrameCount() const { return source->getFrameCount(); }
+    size_t getCurrentFrameIndex() const { return currentFrame; }
+
     void setFrameTime(float time) { frameTime = time; }
     void setLooping(bool loop) { isLooping = loop; }
-    void setMaxLoadedFrames(size_t max) { maxLoadedFrames = max; }
-    
+    void setSpeed(float multiplier) { speed = multiplier; }
+    float getSpeed() const { return speed; }
+
+    // The settings below belong to the shared source
+    void setMaxLoadedFrames(size_t max) { source->setMaxLoadedFrames(max); }
+    size_t getMaxLoadedFrames() const { return source->getMaxLoadedFrames(); }
+    void setFrameFormat(FrameFormat format) { source->setFrameFormat(format); }
+    FrameFormat getFrameFormat() const { return source->getFrameFormat(); }
+    void setTargetSize(const sf::Vector2u& size) { source->setTargetSize(size); }
+    unsigned int getDecodeScale() const { return source->getDecodeScale(); }
+    size_t getMemoryUsage() const { return source->getMemoryUsage(); }
+    void setPrefetcher(FramePrefetcher* prefetcher) { source->setPrefetcher(prefetcher); }
+    // Decodes the frames this playhead shows next in the background
+    void prefetchAhead(size_t count) { source->prefetchAhead(currentFrame, count, isLooping); }
+
+    const std::shared_ptr<FrameSource>& getSource() const { return source; }
+
 private:
-    std::shared_ptr<sf::Texture> ensureFrameLoaded(size_t index);
-    void maintainFrameWindow();
-    
+    void showFrame(const std::shared_ptr<AnimationFrame>& frame);
+    void goToFrame(size_t index);
+
+    std::shared_ptr<FrameSource> source;
+    size_t playhead;
+
     float frameTime;
     float currentTime;
     size_t currentFrame;
+    float speed;
     bool playing;
     bool isLooping;
-    size_t totalMemoryUsage;
-    size_t maxLoadedFrames;
-    bool isInitialLoad;
-    
-    std::recursive_mutex frameMutex;
-    std::deque<std::pair<size_t, std::shared_ptr<sf::Texture>>> loadedFrames;
-    std::vector<std::filesystem::path> framePaths;
-    std::shared_ptr<sf::Texture> currentTexture;  // Keep as shared_ptr
+
+    std::shared_ptr<AnimationFrame> currentFrameData;  // Keep as shared_ptr
     sf::Sprite currentSprite;
-    
-    static constexpr size_t DEFAULT_MAX_FRAMES = 60;  // Default to 2 seconds at 30 FPS
-}; 
\ No newline at end of file
+    std::unique_ptr<sf::Shader> yuvShader;  // Created with the first YUV frame
+};
@@ -1,9 +1,20 @@
 #include "AnimationManager.hpp"
 #include "../../config/AssetPaths.hpp"
+#include "../ui/ScalingManager.hpp"
+#include "../render/TextureStreamer.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+#include <iostream>
 
 bool AnimationManager::loadAnimation(const std::string& name, const std::string& path, bool looping) {
     auto animation = std::make_unique<Animation>();
     
+    // Decode at the window's scale from the first frame on, so frames
+    // prefetched for this size are the ones the animation asks for
+    animation->setPrefetcher(&prefetcher);
+    animation->setTargetSize(Engine::ScalingManager::getInstance().getRenderSize());
+    prefetched.erase(path);
+    
     if (!animation->loadFromDirectory(path)) {
         return false;
     }
@@ -23,8 +34,99 @@ Animation* AnimationManager::getAnimation(const std::string& name) {
     return nullptr;
 }
 
+Animation* AnimationManager::createInstance(const std::string& name, const std::string& sourceName, bool looping) {
+    Animation* original = getAnimation(sourceName);
+    if (!original) {
+        std::cerr << "AnimationManager::createInstance: Unknown animation: " << sourceName << std::endl;
+        return nullptr;
+    }
+    
+    auto instance = std::make_unique<Animation>(original->getSource());
+    instance->setFrameTime(FRAME_TIME);
+    instance->setLooping(looping);
+    
+    Animation* result = instance.get();
+    animations[name] = std::move(instance);
+    return result;
+}
+
 void AnimationManager::update(float deltaTime) {
     for (auto& [name, animation] : animations) {
         animation->update(deltaTime);
     }
-} 
\ No newline at end of file
+}
+
+void AnimationManager::prefetch(const std::string& path, size_t frameCount) {
+    // Same tier and scale choice as FrameSource::setTargetSize
+    std::vector<FrameSource::Tier> tiers = FrameSource::discoverTiers(path);
+    if (tiers.empty()) {
+        return;
+    }
+    unsigned int scale = 1;
+    const auto& tier = tiers[FrameSource::selectTier(tiers, Engine::ScalingManager::getInstance().getRenderSize(), scale)];
+    
+    // Hovering back and forth over a button must not requeue anything
+    std::pair<unsigned int, unsigned int> resolution(tier.denominator, scale);
+    auto it = prefetched.find(path);
+    if (it != prefetched.end() && it->second == resolution) {
+        return;
+    }
+    prefetched[path] = resolution;
+    
+    std::vector<std::string> frames(tier.paths.begin(), tier.paths.begin() + std::min(tier.paths.size(), frameCount));
+    prefetcher.request(frames, scale, sf::Shader::isAvailable());
+}
+
+void AnimationManager::suspend(size_t floorFrames) {
+    if (suspended) {
+        return;
+    }
+    suspended = true;
+    
+    prefetcher.clear();
+    prefetched.clear();
+    size_t releasedBytes = 0;
+    for (auto& [name, animation] : animations) {
+        const auto& source = animation->getSource();
+        bool seen = std::any_of(suspendedWindows.begin(), suspendedWindows.end(),
+            [&source](const auto& entry) { return entry.first.lock() == source; });
+        if (seen) {
+            continue;  // Shared source, already handled
+        }
+        suspendedWindows.emplace_back(source, source->getMaxLoadedFrames());
+        size_t before = source->getMemoryUsage();
+        source->setPrefetcher(nullptr);
+        source->setMaxLoadedFrames(std::min(floorFrames, source->getMaxLoadedFrames()));
+        releasedBytes += before - source->getMemoryUsage();
+    }
+    
+    auto& streamer = Engine::TextureStreamer::getInstance();
+    suspendedPoolSize = streamer.getMaxPooledTextures();
+    streamer.setMaxPooledTextures(0);
+    
+    TSS_LOG_INFO("AnimationManager", "Suspended", Engine::field("floorFrames", floorFrames),
+                 Engine::field("releasedBytes", releasedBytes));
+}
+
+void AnimationManager::resume() {
+    if (!suspended) {
+        return;
+    }
+    suspended = false;
+    
+    Engine::TextureStreamer::getInstance().setMaxPooledTextures(suspendedPoolSize);
+    for (auto& [weakSource, maxFrames] : suspendedWindows) {
+        // Sources replaced in the meantime are gone
+        if (auto source = weakSource.lock()) {
+            source->setMaxLoadedFrames(maxFrames);
+            source->setPrefetcher(&prefetcher);
+        }
+    }
+    suspendedWindows.clear();
+    
+    // Refill ahead of each playhead before normal playback resumes
+    for (auto& [name, animation] : animations) {
+        animation->prefetchAhead(PREFETCH_FRAMES);
+    }
+    TSS_LOG_INFO("AnimationManager", "Resumed");
+}
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Animation.hpp"
+#include "FramePrefetcher.hpp"
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 class AnimationManager {
 public:
@@ -18,9 +21,30 @@ public:
     // Get animation by name
     Animation* getAnimation(const std::string& name);
     
+    // A second playhead over an already loaded animation's frames, with its
+    // own time, speed and loop mode; frames are decoded once for both
+    Animation* createInstance(const std::string& name, const std::string& sourceName, bool looping = true);
+    
     // Update all playing animations
     void update(float deltaTime);
     
+    // Hint that the animation in `path` is likely to be loaded soon: its
+    // first frames are decoded in the background at the scale the window
+    // needs, and loadAnimation() picks them up instead of decoding again
+    void prefetch(const std::string& path, size_t frameCount = PREFETCH_FRAMES);
+    
+    // While the window is in the background: every source keeps at most
+    // `floorFrames` frames, nothing is decoded ahead and pooled textures
+    // are freed
+    void suspend(size_t floorFrames);
+    // Restores the frame windows and decodes the frames ahead of every
+    // playhead; isRefilling() is true until they are ready
+    void resume();
+    bool isRefilling() const { return prefetcher.isBusy(); }
+    bool isSuspended() const { return suspended; }
+    
+    static constexpr size_t PREFETCH_FRAMES = 8;
+    
 private:
     AnimationManager() = default;
     ~AnimationManager() = default;
@@ -29,4 +53,12 @@ private:
     
     static constexpr float FRAME_TIME = 1.0f/30.0f;  // Hardcoded 30 FPS
     std::unordered_map<std::string, std::unique_ptr<Animation>> animations;
+    FramePrefetcher prefetcher;
+    // Path -> (tier, scale) requested, until loaded
+    std::unordered_map<std::string, std::pair<unsigned int, unsigned int>> prefetched;
+    
+    bool suspended = false;
+    // Frame window to restore, per source
+    std::vector<std::pair<std::weak_ptr<FrameSource>, size_t>> suspendedWindows;
+    size_t suspendedPoolSize = 0;
 }; 
\ No newline at end of file
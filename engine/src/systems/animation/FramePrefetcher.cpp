@@ -0,0 +1,156 @@
+#include "FramePrefetcher.hpp"
+#include "FrameStore.hpp"
+#include "../../core/Logger.hpp"
+#include "../../resources/VirtualFileSystem.hpp"
+#include <algorithm>
+
+FramePrefetcher::FramePrefetcher()
+    : cachedBytes(0)
+    , maxBytes(DEFAULT_MAX_BYTES)
+    , stopping(false)
+{
+    worker = std::thread(&FramePrefetcher::workerLoop, this);
+}
+
+FramePrefetcher::~FramePrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        queue.clear();
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+std::string FramePrefetcher::makeKey(const std::string& framePath, unsigned int scale) {
+    return framePath + '@' + std::to_string(scale);
+}
+
+void FramePrefetcher::request(const std::vector<std::string>& framePaths, unsigned int scale, bool yuv) {
+    std::size_t queued = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& path : framePaths) {
+            std::string key = makeKey(path, scale);
+            if (ready.count(key) || !queuedKeys.insert(key).second) {
+                continue;
+            }
+            queue.push_back({ path, std::move(key), scale, yuv });
+            ++queued;
+        }
+    }
+    if (queued > 0) {
+        wake.notify_one();
+        TSS_LOG_TRACE("FramePrefetcher", "Queued frames", Engine::field("count", queued),
+                      Engine::field("scale", scale));
+    }
+}
+
+std::shared_ptr<DecodedFrame> FramePrefetcher::take(const std::string& framePath, unsigned int scale) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ready.find(makeKey(framePath, scale));
+    if (it == ready.end()) {
+        return nullptr;
+    }
+    auto frame = std::move(it->second);
+    readyOrder.erase(std::find(readyOrder.begin(), readyOrder.end(), it->first));
+    ready.erase(it);
+    cachedBytes -= frame->getMemoryUsage();
+    return frame;
+}
+
+void FramePrefetcher::discard(const std::string& framePath, unsigned int scale) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string key = makeKey(framePath, scale);
+    if (auto it = ready.find(key); it != ready.end()) {
+        cachedBytes -= it->second->getMemoryUsage();
+        readyOrder.erase(std::find(readyOrder.begin(), readyOrder.end(), key));
+        ready.erase(it);
+        return;
+    }
+    // A decode in progress is dropped by the worker once the key is gone
+    if (queuedKeys.erase(key) > 0) {
+        queue.erase(std::remove_if(queue.begin(), queue.end(),
+                                   [&key](const Request& request) { return request.key == key; }),
+                    queue.end());
+    }
+}
+
+void FramePrefetcher::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.clear();
+    queuedKeys.clear();
+    ready.clear();
+    readyOrder.clear();
+    cachedBytes = 0;
+}
+
+bool FramePrefetcher::isBusy() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !queuedKeys.empty();
+}
+
+std::size_t FramePrefetcher::getCachedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cachedBytes;
+}
+
+void FramePrefetcher::setMaxBytes(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maxBytes = bytes;
+    evict();
+}
+
+std::shared_ptr<DecodedFrame> FramePrefetcher::decode(const Request& request) {
+    Engine::AssetFile file = Engine::VirtualFileSystem::getInstance().open(request.path);
+    if (!file) {
+        return nullptr;
+    }
+
+    auto frame = std::make_shared<DecodedFrame>();
+    frame->hash = FrameStore::hashFile(file.data(), file.size());
+    if (request.yuv && Engine::JpegDecoder::decodeYuv420(file.data(), file.size(), frame->yuv, request.scale)) {
+        frame->isYuv = true;
+        return frame;
+    }
+    if (Engine::JpegDecoder::decodeRgba(file.data(), file.size(), frame->rgba, request.scale)) {
+        return frame;
+    }
+    // Not a JPEG: left to the regular load path
+    return nullptr;
+}
+
+void FramePrefetcher::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wake.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (stopping) {
+            return;
+        }
+
+        Request request = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+
+        auto frame = decode(request);
+
+        lock.lock();
+        // Cleared while decoding: the result is no longer wanted
+        if (queuedKeys.erase(request.key) == 0 || !frame) {
+            continue;
+        }
+        cachedBytes += frame->getMemoryUsage();
+        readyOrder.push_back(request.key);
+        ready[request.key] = std::move(frame);
+        evict();
+    }
+}
+
+void FramePrefetcher::evict() {
+    while (cachedBytes > maxBytes && !readyOrder.empty()) {
+        auto it = ready.find(readyOrder.front());
+        cachedBytes -= it->second->getMemoryUsage();
+        ready.erase(it);
+        readyOrder.pop_front();
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../../resources/JpegDecoder.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// A frame decoded on the prefetch thread, waiting for its texture upload
+struct DecodedFrame {
+    std::uint64_t hash = 0;       // FrameStore::hashFile of the source file
+    bool isYuv = false;
+    Engine::YuvImage yuv;
+    Engine::RgbaImage rgba;
+
+    std::size_t getMemoryUsage() const { return isYuv ? yuv.getMemoryUsage() : rgba.pixels.size(); }
+};
+
+// Decodes animation frames on a background thread ahead of time. Only the
+// CPU side (JPEG decode) runs there; textures are created on the main
+// thread when an Animation takes the frame. Decoded frames are kept until
+// taken or until the cache exceeds its budget, oldest first.
+class FramePrefetcher {
+public:
+    static constexpr std::size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    FramePrefetcher();
+    ~FramePrefetcher();
+
+    // Queues frames for decoding at `scale`; frames already queued or
+    // decoded are skipped. YUV frames that turn out not to be 4:2:0 are
+    // decoded to RGBA instead, as Animation would.
+    void request(const std::vector<std::string>& framePaths, unsigned int scale, bool yuv);
+
+    // Hands over a decoded frame, or null if it is not ready
+    std::shared_ptr<DecodedFrame> take(const std::string& framePath, unsigned int scale);
+
+    // Drops the frame, decoded or still queued, once it was loaded some
+    // other way
+    void discard(const std::string& framePath, unsigned int scale);
+
+    void clear();
+    // True while requested frames are still being decoded
+    bool isBusy() const;
+    std::size_t getCachedBytes() const;
+    void setMaxBytes(std::size_t bytes);
+
+    FramePrefetcher(const FramePrefetcher&) = delete;
+    FramePrefetcher& operator=(const FramePrefetcher&) = delete;
+
+private:
+    struct Request {
+        std::string path;
+        std::string key;
+        unsigned int scale;
+        bool yuv;
+    };
+
+    static std::string makeKey(const std::string& framePath, unsigned int scale);
+    static std::shared_ptr<DecodedFrame> decode(const Request& request);
+    void workerLoop();
+    void evict();
+
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::deque<Request> queue;
+    std::unordered_set<std::string> queuedKeys;
+    std::unordered_map<std::string, std::shared_ptr<DecodedFrame>> ready;
+    std::deque<std::string> readyOrder;       // Oldest first, for eviction
+    std::size_t cachedBytes;
+    std::size_t maxBytes;
+    bool stopping;
+    std::thread worker;
+};
@@ -0,0 +1,543 @@
+#include "FrameSource.hpp"
+#include "FramePrefetcher.hpp"
+#include "FrameStore.hpp"
+#include "../../core/Logger.hpp"
+#include "../../resources/AnimationTiers.hpp"
+#include "../../resources/JpegDecoder.hpp"
+#include "../../resources/ResourceManager.hpp"
+#include "../../resources/VirtualFileSystem.hpp"
+#include "../render/TextureStreamer.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Full-range BT.601 (JFIF) YCbCr -> RGB. Each plane texel holds 4
+    // consecutive samples, so filtering is done by hand on nearest fetches.
+    const char* YUV_FRAGMENT_SHADER = R"(
+        uniform sampler2D luma;
+        uniform sampler2D chromaB;
+        uniform sampler2D chromaR;
+        uniform vec2 lumaSize;      // Plane texture sizes in texels
+        uniform vec2 chromaSize;
+        uniform float chromaScale;  // Chroma samples per luma sample
+
+        float fetchSample(sampler2D plane, vec2 size, vec2 position) {
+            position = clamp(position, vec2(0.0), vec2(size.x * 4.0 - 1.0, size.y - 1.0));
+            float texelX = floor(position.x * 0.25);
+            vec4 texel = texture2D(plane, (vec2(texelX, position.y) + 0.5) / size);
+            float channel = position.x - texelX * 4.0;
+            return dot(texel, vec4(equal(vec4(channel), vec4(0.0, 1.0, 2.0, 3.0))));
+        }
+
+        float samplePlane(sampler2D plane, vec2 size, vec2 position) {
+            vec2 p = position - 0.5;
+            vec2 base = floor(p);
+            vec2 f = p - base;
+            float a = fetchSample(plane, size, base);
+            float b = fetchSample(plane, size, base + vec2(1.0, 0.0));
+            float c = fetchSample(plane, size, base + vec2(0.0, 1.0));
+            float d = fetchSample(plane, size, base + vec2(1.0, 1.0));
+            return mix(mix(a, b, f.x), mix(c, d, f.x), f.y);
+        }
+
+        void main() {
+            // Texture coordinates are normalized against the packed luma
+            // texture, so this yields the position in frame pixels
+            vec2 position = gl_TexCoord[0].xy * lumaSize;
+            float y = samplePlane(luma, lumaSize, position);
+            float cb = samplePlane(chromaB, chromaSize, position * chromaScale) - 0.5019608;
+            float cr = samplePlane(chromaR, chromaSize, position * chromaScale) - 0.5019608;
+            vec3 rgb = vec3(y + 1.402 * cr,
+                            y - 0.344136 * cb - 0.714136 * cr,
+                            y + 1.772 * cb);
+            gl_FragColor = vec4(clamp(rgb, 0.0, 1.0), 1.0) * gl_Color;
+        }
+    )";
+}
+
+
+FrameSource::FrameSource()
+    : totalMemoryUsage(0)
+    , maxLoadedFrames(DEFAULT_MAX_FRAMES)
+    , isInitialLoad(true)
+    , frameFormat(FrameFormat::Yuv420)
+    , yuvChecked(false)
+    , decodeScale(1)
+    , currentTier(0)
+    , prefetcher(nullptr)
+{
+}
+
+FrameSource::~FrameSource() {
+    TSS_LOG_TRACE("FrameSource", "Destroying", Engine::field("frames", loadedFrames.size()));
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    loadedFrames.clear();
+    framePaths.clear();
+}
+
+std::unique_ptr<sf::Shader> FrameSource::createYuvShader() {
+    if (!sf::Shader::isAvailable()) {
+        return nullptr;
+    }
+    auto shader = std::make_unique<sf::Shader>();
+    if (!shader->loadFromMemory(YUV_FRAGMENT_SHADER, sf::Shader::Fragment)) {
+        return nullptr;
+    }
+    shader->setUniform("luma", sf::Shader::CurrentTexture);
+    return shader;
+}
+
+bool FrameSource::canUseYuv() {
+    if (frameFormat != FrameFormat::Yuv420) {
+        return false;
+    }
+    if (!yuvChecked) {
+        yuvChecked = true;
+        if (!createYuvShader()) {
+            std::cerr << "FrameSource: YUV shader unavailable, decoding frames to RGBA" << std::endl;
+            frameFormat = FrameFormat::Rgba;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FrameSource::loadFromDirectory(const std::string& path, const std::string& extension) {
+    auto& vfs = Engine::VirtualFileSystem::getInstance();
+    
+    try {
+        if (!vfs.isDirectory(path)) {
+            std::cerr << "FrameSource::loadFromDirectory: Directory does not exist: " << path << std::endl;
+            return false;
+        }
+        
+        // Clear existing frames and reset state
+        {
+            std::lock_guard<std::recursive_mutex> lock(frameMutex);
+            loadedFrames.clear();
+            framePaths.clear();
+            tiers.clear();
+            totalMemoryUsage = 0;
+            isInitialLoad = true;  // Set initial load flag
+        }
+        
+        // Get all files with matching extension, sorted by name to ensure correct sequence
+        std::vector<Tier> found = discoverTiers(path, extension);
+        
+        if (found.empty()) {
+            std::cerr << "FrameSource::loadFromDirectory: No files found with extension " << extension << " in " << path << std::endl;
+            return false;
+        }
+        
+        // Start at full size; applyTargetSize() picks the tier for the window
+        {
+            tiers = std::move(found);
+            currentTier = 0;
+            decodeScale = 1;
+            framePaths = tiers[0].paths;
+            directory = path;
+        }
+        applyTargetSize();
+        
+        // Load initial frame to get dimensions
+        auto firstFrame = getFrame(0);
+        if (!firstFrame) {
+            std::cerr << "FrameSource::loadFromDirectory: Failed to load first frame" << std::endl;
+            return false;
+        }
+        
+        TSS_LOG_DEBUG("FrameSource", "Loaded directory",
+                      Engine::field("path", path),
+                      Engine::field("frames", framePaths.size()),
+                      Engine::field("tiers", tiers.size()),
+                      Engine::field("width", firstFrame->size.x),
+                      Engine::field("height", firstFrame->size.y),
+                      Engine::field("format", firstFrame->isYuv() ? "yuv420" : "rgba"));
+        
+        // Initial loading phase complete
+        isInitialLoad = false;
+        
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "FrameSource::loadFromDirectory: Exception: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::getFrame(size_t index) {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    
+    if (index >= framePaths.size()) {
+        std::cerr << "FrameSource::getFrame: Invalid frame index: " << index << std::endl;
+        return nullptr;
+    }
+    
+    // First, check if we already have this frame
+    for (const auto& pair : loadedFrames) {
+        if (pair.first == index) {
+            return pair.second;
+        }
+    }
+    
+    try {
+        // A frame decoded ahead of time comes with its hash, so the file is
+        // only read here when it wasn't prefetched
+        std::shared_ptr<DecodedFrame> decoded;
+        if (prefetcher) {
+            decoded = prefetcher->take(framePaths[index], decodeScale);
+            if (!decoded) {
+                // Shared or loaded below; a pending decode is no longer wanted
+                prefetcher->discard(framePaths[index], decodeScale);
+            }
+        }
+        std::uint64_t hash = 0;
+        bool hashed = false;
+        if (decoded) {
+            hash = decoded->hash;
+            hashed = true;
+        } else if (Engine::AssetFile file = Engine::VirtualFileSystem::getInstance().open(framePaths[index])) {
+            hash = FrameStore::hashFile(file.data(), file.size());
+            hashed = true;
+        }
+        
+        // Identical frames (in this animation or any other) share textures
+        auto& store = FrameStore::getInstance();
+        std::shared_ptr<AnimationFrame> frame;
+        if (hashed) {
+            frame = store.find(hash, decodeScale);
+            if (frame && frame->isYuv() && !canUseYuv()) {
+                frame.reset();
+            }
+        }
+        const bool shared = frame != nullptr;
+        
+        if (!frame && decoded) {
+            frame = uploadPrefetchedFrame(index, *decoded);
+        }
+        if (!frame && canUseYuv()) {
+            frame = loadYuvFrame(index);
+        }
+        if (!frame) {
+            frame = loadRgbaFrame(index);
+        }
+        if (!frame) {
+            return nullptr;
+        }
+        
+        if (hashed && !shared) {
+            store.insert(hash, decodeScale, frame);
+        }
+        store.recordLoad(directory, *frame, shared);
+        
+        // Add to loaded frames
+        loadedFrames.push_back({index, frame});
+        totalMemoryUsage += frame->memoryUsage;
+        
+        // Only maintain frame window if we're not in initial loading
+        if (!isInitialLoad) {
+            maintainFrameWindow();
+        }
+        
+        return frame;
+    } catch (const std::exception& e) {
+        std::cerr << "FrameSource::getFrame: Exception: " << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::loadRgbaFrame(size_t index) {
+    sf::Image image;
+    if (!Engine::ResourceManager::getInstance().loadImage(image, framePaths[index], decodeScale)) {
+        std::cerr << "FrameSource::getFrame: Failed to load texture: " << framePaths[index] << std::endl;
+        return nullptr;
+    }
+    return uploadRgbaFrame(index, image.getPixelsPtr(), image.getSize());
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::uploadRgbaFrame(size_t index, const sf::Uint8* pixels, const sf::Vector2u& size) {
+    // Stream the decoded pixels into a recycled texture
+    auto& streamer = Engine::TextureStreamer::getInstance();
+    auto frame = std::make_shared<AnimationFrame>();
+    frame->texture = streamer.acquire(size.x, size.y);
+    if (!frame->texture) {
+        std::cerr << "FrameSource::getFrame: Failed to allocate texture" << std::endl;
+        return nullptr;
+    }
+    
+    frame->texture->setSmooth(true);
+    
+    if (!streamer.upload(*frame->texture, pixels, size.x, size.y)) {
+        std::cerr << "FrameSource::getFrame: Failed to upload texture: " << framePaths[index] << std::endl;
+        return nullptr;
+    }
+    
+    frame->size = size;
+    frame->memoryUsage = size.x * size.y * 4;
+    return frame;
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::loadYuvFrame(size_t index) {
+    Engine::AssetFile file = Engine::VirtualFileSystem::getInstance().open(framePaths[index]);
+    if (!file) {
+        return nullptr;
+    }
+    
+    // Not 4:2:0 (or not a JPEG): the caller decodes it as RGBA instead
+    Engine::YuvImage image;
+    if (!Engine::JpegDecoder::decodeYuv420(file.data(), file.size(), image, decodeScale)) {
+        return nullptr;
+    }
+    return uploadYuvFrame(index, image);
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::uploadYuvFrame(size_t index, const Engine::YuvImage& image) {
+    // Each plane row is uploaded as stride/4 RGBA texels
+    const unsigned int lumaWidth = image.lumaStride / 4;
+    const unsigned int chromaWidth = image.chromaStride / 4;
+    
+    auto& streamer = Engine::TextureStreamer::getInstance();
+    auto frame = std::make_shared<AnimationFrame>();
+    frame->texture = streamer.acquire(lumaWidth, image.height);
+    frame->chromaB = streamer.acquire(chromaWidth, image.chromaHeight);
+    frame->chromaR = streamer.acquire(chromaWidth, image.chromaHeight);
+    if (!frame->texture || !frame->chromaB || !frame->chromaR) {
+        std::cerr << "FrameSource::getFrame: Failed to allocate YUV planes" << std::endl;
+        return nullptr;
+    }
+    
+    // Samples are packed, so texels must never be blended by the sampler
+    frame->texture->setSmooth(false);
+    frame->chromaB->setSmooth(false);
+    frame->chromaR->setSmooth(false);
+    
+    if (!streamer.upload(*frame->texture, image.luma.data(), lumaWidth, image.height) ||
+        !streamer.upload(*frame->chromaB, image.chromaB.data(), chromaWidth, image.chromaHeight) ||
+        !streamer.upload(*frame->chromaR, image.chromaR.data(), chromaWidth, image.chromaHeight)) {
+        std::cerr << "FrameSource::getFrame: Failed to upload YUV planes: " << framePaths[index] << std::endl;
+        return nullptr;
+    }
+    
+    frame->size = sf::Vector2u(image.width, image.height);
+    frame->chromaDivisor = image.chromaDivisor;
+    frame->memoryUsage = static_cast<size_t>(image.lumaStride) * image.height +
+                         static_cast<size_t>(image.chromaStride) * image.chromaHeight * 2;
+    return frame;
+}
+
+std::shared_ptr<AnimationFrame> FrameSource::uploadPrefetchedFrame(size_t index, const DecodedFrame& decoded) {
+    if (decoded.isYuv) {
+        // Without the shader the planes are useless; decode again as RGBA
+        if (!canUseYuv()) {
+            return nullptr;
+        }
+        return uploadYuvFrame(index, decoded.yuv);
+    }
+    
+    const auto& rgba = decoded.rgba;
+    return uploadRgbaFrame(index, rgba.pixels.data(), sf::Vector2u(rgba.width, rgba.height));
+}
+
+void FrameSource::setTargetSize(const sf::Vector2u& size) {
+    if (size == targetSize) {
+        return;
+    }
+    targetSize = size;
+    applyTargetSize();
+}
+
+void FrameSource::applyTargetSize() {
+    // Before loadFromDirectory() the size is only remembered
+    if (tiers.empty() || tiers[0].size.x == 0 || tiers[0].size.y == 0 ||
+        targetSize.x == 0 || targetSize.y == 0) {
+        return;
+    }
+    
+    unsigned int scale = 1;
+    size_t tier = selectTier(tiers, targetSize, scale);
+    if (tier == currentTier && scale == decodeScale) {
+        return;
+    }
+    
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    currentTier = tier;
+    decodeScale = scale;
+    framePaths = tiers[tier].paths;
+    
+    // Drop frames decoded at the old resolution; frames on screen stay
+    // alive in their playheads until replaced
+    loadedFrames.clear();
+    totalMemoryUsage = 0;
+    
+    TSS_LOG_DEBUG("FrameSource", "Decode resolution changed",
+                  Engine::field("tier", tiers[tier].denominator),
+                  Engine::field("denominator", decodeScale),
+                  Engine::field("targetWidth", targetSize.x),
+                  Engine::field("targetHeight", targetSize.y));
+}
+
+std::vector<FrameSource::Tier> FrameSource::discoverTiers(const std::string& path, const std::string& extension) {
+    auto& vfs = Engine::VirtualFileSystem::getInstance();
+    auto readSize = [&vfs](Tier& tier) {
+        if (Engine::AssetFile first = vfs.open(tier.paths[0])) {
+            Engine::JpegDecoder::readSize(first.data(), first.size(), tier.size.x, tier.size.y);
+        }
+    };
+    
+    std::vector<Tier> found(1);
+    found[0].paths = vfs.list(path, extension);
+    if (found[0].paths.empty()) {
+        return {};
+    }
+    readSize(found[0]);
+    
+    for (unsigned int denominator : Engine::AnimationTiers::DENOMINATORS) {
+        Tier tier;
+        tier.denominator = denominator;
+        tier.paths = vfs.list(Engine::AnimationTiers::directoryFor(path, denominator), extension);
+        // A tier missing frames would make playback skip
+        if (tier.paths.size() != found[0].paths.size()) {
+            continue;
+        }
+        readSize(tier);
+        if (tier.size.x > 0 && tier.size.y > 0) {
+            found.push_back(std::move(tier));
+        }
+    }
+    return found;
+}
+
+size_t FrameSource::selectTier(const std::vector<Tier>& tiers, const sf::Vector2u& target, unsigned int& scale) {
+    // Tiers are largest first; the last one covering the target wins
+    size_t chosen = 0;
+    for (size_t i = 1; i < tiers.size(); ++i) {
+        if (tiers[i].size.x >= target.x && tiers[i].size.y >= target.y) {
+            chosen = i;
+        }
+    }
+    const sf::Vector2u& size = tiers[chosen].size;
+    scale = Engine::JpegDecoder::chooseScaleDenominator(size.x, size.y, target.x, target.y);
+    return chosen;
+}
+
+size_t FrameSource::addPlayhead() {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    auto it = std::find(playheads.begin(), playheads.end(), NO_PLAYHEAD);
+    if (it != playheads.end()) {
+        *it = 0;
+        return static_cast<size_t>(it - playheads.begin());
+    }
+    playheads.push_back(0);
+    return playheads.size() - 1;
+}
+
+void FrameSource::removePlayhead(size_t id) {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    if (id < playheads.size()) {
+        playheads[id] = NO_PLAYHEAD;
+    }
+}
+
+void FrameSource::movePlayhead(size_t id, size_t frame, bool looping) {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    if (id >= playheads.size() || framePaths.empty()) {
+        return;
+    }
+    playheads[id] = frame;
+    
+    // Decode the next few frames in the background; the prefetcher skips
+    // frames another playhead already asked for
+    prefetchAhead(frame, PREFETCH_AHEAD, looping);
+}
+
+void FrameSource::prefetchAhead(size_t frame, size_t count, bool looping) {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    if (!prefetcher || framePaths.empty()) {
+        return;
+    }
+    
+    std::vector<std::string> ahead;
+    for (size_t step = 1; step <= count; ++step) {
+        size_t index = frame + step;
+        if (index >= framePaths.size()) {
+            if (!looping) {
+                break;
+            }
+            index %= framePaths.size();
+        }
+        bool resident = std::any_of(loadedFrames.begin(), loadedFrames.end(),
+            [index](const auto& pair) { return pair.first == index; });
+        if (!resident) {
+            ahead.push_back(framePaths[index]);
+        }
+    }
+    if (!ahead.empty()) {
+        prefetcher->request(ahead, decodeScale, canUseYuv());
+    }
+}
+
+void FrameSource::setMaxLoadedFrames(size_t max) {
+    std::lock_guard<std::recursive_mutex> lock(frameMutex);
+    bool shrinking = max < maxLoadedFrames;
+    maxLoadedFrames = max;
+    if (shrinking && !loadedFrames.empty()) {
+        maintainFrameWindow();
+    }
+}
+
+size_t FrameSource::distanceToPlayhead(size_t index) const {
+    size_t nearest = NO_PLAYHEAD;
+    for (size_t position : playheads) {
+        if (position != NO_PLAYHEAD) {
+            size_t distance = index > position ? index - position : position - index;
+            nearest = std::min(nearest, distance);
+        }
+    }
+    return nearest;
+}
+
+void FrameSource::maintainFrameWindow() {
+    // Each playhead keeps a window of frames around itself; a frame stays
+    // resident while it is inside the union of those windows
+    size_t halfWindow = maxLoadedFrames / 2;
+    size_t activePlayheads = 0;
+    auto inWindow = [&](size_t index) {
+        for (size_t position : playheads) {
+            if (position == NO_PLAYHEAD) {
+                continue;
+            }
+            size_t windowStart = (position >= halfWindow) ? position - halfWindow : 0;
+            size_t windowEnd = std::min(windowStart + maxLoadedFrames, framePaths.size());
+            if (index >= windowStart && index <= windowEnd) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (size_t position : playheads) {
+        if (position != NO_PLAYHEAD) {
+            ++activePlayheads;
+        }
+    }
+    
+    std::deque<std::pair<size_t, std::shared_ptr<AnimationFrame>>> newFrames;
+    for (const auto& pair : loadedFrames) {
+        if (inWindow(pair.first)) {
+            newFrames.push_back(pair);
+        } else {
+            totalMemoryUsage -= pair.second->memoryUsage;
+        }
+    }
+    
+    // If we still have too many frames, remove the ones furthest from any playhead
+    size_t budget = maxLoadedFrames * std::max<size_t>(activePlayheads, 1);
+    while (newFrames.size() > budget) {
+        auto furthestIt = std::max_element(newFrames.begin(), newFrames.end(),
+            [this](const auto& a, const auto& b) {
+                return distanceToPlayhead(a.first) < distanceToPlayhead(b.first);
+            });
+        totalMemoryUsage -= furthestIt->second->memoryUsage;
+        newFrames.erase(furthestIt);
+    }
+    
+    loadedFrames.swap(newFrames);
+}
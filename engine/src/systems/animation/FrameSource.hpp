@@ -0,0 +1,136 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class FramePrefetcher;
+struct DecodedFrame;
+namespace Engine { struct YuvImage; }
+
+// How decoded frames are kept in VRAM
+enum class FrameFormat {
+    Rgba,     // One RGBA8 texture per frame (4 bytes/pixel)
+    Yuv420    // Y, Cb, Cr planes converted by a shader at draw time (1.5 bytes/pixel)
+};
+
+// One resident frame. YUV planes are packed 4 samples per RGBA texel, so the
+// luma texture is a quarter of the frame width; the sprite's texture rect
+// still spans the full frame size.
+struct AnimationFrame {
+    std::shared_ptr<sf::Texture> texture;   // RGBA image, or the luma plane
+    std::shared_ptr<sf::Texture> chromaB;   // Null for RGBA frames
+    std::shared_ptr<sf::Texture> chromaR;
+    sf::Vector2u size;                      // Decoded size (after DCT scaling)
+    unsigned int chromaDivisor = 2;         // Luma samples per chroma sample
+    size_t memoryUsage = 0;
+
+    bool isYuv() const { return chromaB != nullptr; }
+};
+
+// The frames of one animation directory, shared by any number of Animation
+// playheads. A frame stays resident while it is inside the window of some
+// playhead, and the frames just ahead of every playhead are decoded in the
+// background when a prefetcher is attached.
+class FrameSource {
+public:
+    FrameSource();
+    ~FrameSource();
+
+    // Replaces the frames for every playhead sharing this source
+    bool loadFromDirectory(const std::string& path, const std::string& extension = ".jpg");
+
+    // Loads the frame if it is not resident
+    std::shared_ptr<AnimationFrame> getFrame(size_t index);
+
+    bool hasFrames() const { return !framePaths.empty(); }
+    size_t getFrameCount() const { return framePaths.size(); }
+    const std::string& getDirectory() const { return directory; }
+
+    // Each playhead keeps the frames around its position resident
+    size_t addPlayhead();
+    void removePlayhead(size_t id);
+    void movePlayhead(size_t id, size_t frame, bool looping);
+
+    // Frames kept around each playhead; lowering it releases the frames
+    // outside the new window at once
+    void setMaxLoadedFrames(size_t max);
+    size_t getMaxLoadedFrames() const { return maxLoadedFrames; }
+
+    // Decodes the `count` frames after `frame` in the background (needs a
+    // prefetcher); frames already resident are skipped
+    void prefetchAhead(size_t frame, size_t count, bool looping);
+
+    // Applies to frames decoded afterwards; frames that are not 4:2:0, or
+    // GPUs without shader support, fall back to RGBA
+    void setFrameFormat(FrameFormat format) { frameFormat = format; }
+    FrameFormat getFrameFormat() const { return frameFormat; }
+
+    // Area the frames are drawn filling (usually the window). Frames come
+    // from the smallest tier that still covers it, decoded at 1/2, 1/4 or
+    // 1/8 size when that covers it too. Changing tiers swaps the paths;
+    // frames on screen stay until their playheads move on.
+    void setTargetSize(const sf::Vector2u& size);
+    unsigned int getDecodeScale() const { return decodeScale; }
+    unsigned int getTierDenominator() const { return tiers.empty() ? 1 : tiers[currentTier].denominator; }
+    size_t getMemoryUsage() const { return totalMemoryUsage; }
+
+    // Frames decoded ahead of time are taken from here before decoding
+    void setPrefetcher(FramePrefetcher* source) { prefetcher = source; }
+    FramePrefetcher* getPrefetcher() const { return prefetcher; }
+
+    // One resolution of the frames: the directory itself or a packed tier
+    // (see AnimationTiers.hpp)
+    struct Tier {
+        unsigned int denominator = 1;     // 1 = the directory itself
+        sf::Vector2u size;                // Of the first frame; zero if unknown
+        std::vector<std::string> paths;
+    };
+
+    // The directory and each of its complete tiers, largest first
+    static std::vector<Tier> discoverTiers(const std::string& path, const std::string& extension = ".jpg");
+
+    // Smallest tier covering `target`, and the DCT scale to decode it at
+    static size_t selectTier(const std::vector<Tier>& tiers, const sf::Vector2u& target, unsigned int& scale);
+
+    // The YUV -> RGB shader. Uniforms are per frame, so every playhead
+    // drawing YUV frames needs its own instance.
+    static std::unique_ptr<sf::Shader> createYuvShader();
+
+    static constexpr size_t DEFAULT_MAX_FRAMES = 60;  // Default to 2 seconds at 30 FPS
+    static constexpr size_t PREFETCH_AHEAD = 4;       // Frames decoded ahead of each playhead
+
+private:
+    std::shared_ptr<AnimationFrame> loadRgbaFrame(size_t index);
+    std::shared_ptr<AnimationFrame> loadYuvFrame(size_t index);
+    std::shared_ptr<AnimationFrame> uploadPrefetchedFrame(size_t index, const DecodedFrame& decoded);
+    std::shared_ptr<AnimationFrame> uploadRgbaFrame(size_t index, const sf::Uint8* pixels, const sf::Vector2u& size);
+    std::shared_ptr<AnimationFrame> uploadYuvFrame(size_t index, const Engine::YuvImage& image);
+    void applyTargetSize();
+    bool canUseYuv();
+    void maintainFrameWindow();
+    size_t distanceToPlayhead(size_t index) const;
+
+    static constexpr size_t NO_PLAYHEAD = static_cast<size_t>(-1);
+
+    size_t totalMemoryUsage;
+    size_t maxLoadedFrames;
+    bool isInitialLoad;
+    FrameFormat frameFormat;
+    bool yuvChecked;              // Shader support tested once
+    unsigned int decodeScale;     // JPEG scale denominator for new frames
+    std::vector<Tier> tiers;
+    size_t currentTier;           // framePaths are this tier's paths
+    sf::Vector2u targetSize;      // Zero until setTargetSize()
+    FramePrefetcher* prefetcher;
+
+    std::recursive_mutex frameMutex;
+    std::deque<std::pair<size_t, std::shared_ptr<AnimationFrame>>> loadedFrames;
+    std::vector<std::string> framePaths;  // Logical VFS paths
+    std::string directory;                // For FrameStore stats
+    std::vector<size_t> playheads;        // Frame per playhead id; NO_PLAYHEAD if free
+};
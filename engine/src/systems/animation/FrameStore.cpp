@@ -0,0 +1,85 @@
+#include "FrameStore.hpp"
+#include "FrameSource.hpp"
+#include "../../core/Logger.hpp"
+#include "../../resources/ContentHash.hpp"
+#include <algorithm>
+
+FrameStore& FrameStore::getInstance() {
+    static FrameStore instance;
+    return instance;
+}
+
+std::uint64_t FrameStore::hashFile(const char* data, size_t size) {
+    return Engine::ContentHash::xxh64(data, size);
+}
+
+std::shared_ptr<AnimationFrame> FrameStore::find(std::uint64_t hash, unsigned int scale) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = frames.find({ hash, scale });
+    if (it == frames.end()) {
+        return nullptr;
+    }
+    auto frame = it->second.lock();
+    if (!frame) {
+        frames.erase(it);
+    }
+    return frame;
+}
+
+void FrameStore::insert(std::uint64_t hash, unsigned int scale, const std::shared_ptr<AnimationFrame>& frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    frames[{ hash, scale }] = frame;
+    if (frames.size() >= pruneThreshold) {
+        pruneExpired();
+    }
+}
+
+void FrameStore::pruneExpired() {
+    for (auto it = frames.begin(); it != frames.end();) {
+        if (it->second.expired()) {
+            it = frames.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    // Grow with the live set so pruning stays amortized O(1) per insert
+    pruneThreshold = std::max<size_t>(64, frames.size() * 2);
+}
+
+void FrameStore::recordLoad(const std::string& directory, const AnimationFrame& frame, bool shared) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& stats = directories[directory];
+    ++stats.framesLoaded;
+    if (shared) {
+        ++stats.framesShared;
+        stats.bytesShared += frame.memoryUsage;
+    }
+}
+
+FrameStore::DirectoryStats FrameStore::getStats(const std::string& directory) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = directories.find(directory);
+    return it != directories.end() ? it->second : DirectoryStats{};
+}
+
+size_t FrameStore::getResidentCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = 0;
+    for (const auto& [key, frame] : frames) {
+        if (!frame.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void FrameStore::logReport() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [directory, stats] : directories) {
+        TSS_LOG_INFO("FrameStore", "Dedup savings",
+                     Engine::field("directory", directory),
+                     Engine::field("loaded", stats.framesLoaded),
+                     Engine::field("shared", stats.framesShared),
+                     Engine::field("savedKB", stats.bytesShared / 1024));
+    }
+}
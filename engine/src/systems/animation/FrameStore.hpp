@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct AnimationFrame;
+
+// Resident frames shared by every Animation, keyed by the XXH64 of the
+// compressed frame file and the decode scale. Two frames with identical
+// bytes (holds, fades to black, frames shared by options-enter and
+// options-exit) end up as one set of textures. Only weak references are
+// kept: a frame is freed when the last animation drops it.
+//
+// Only byte-identical files match; re-encoded near-duplicates do not.
+class FrameStore {
+public:
+    // Savings per animation directory, counted as frames are loaded
+    struct DirectoryStats {
+        size_t framesLoaded = 0;      // Frames the animation needed resident
+        size_t framesShared = 0;      // ...of which were already resident
+        size_t bytesShared = 0;       // Texture memory not allocated again
+    };
+
+    static FrameStore& getInstance();
+
+    static std::uint64_t hashFile(const char* data, size_t size);
+
+    // Resident frame with this content and scale, or null
+    std::shared_ptr<AnimationFrame> find(std::uint64_t hash, unsigned int scale);
+    void insert(std::uint64_t hash, unsigned int scale, const std::shared_ptr<AnimationFrame>& frame);
+
+    // Records that `directory` needed a frame; `shared` if find() supplied it
+    void recordLoad(const std::string& directory, const AnimationFrame& frame, bool shared);
+
+    DirectoryStats getStats(const std::string& directory) const;
+    size_t getResidentCount() const;
+
+    // One log line per directory with its savings
+    void logReport() const;
+
+    FrameStore(const FrameStore&) = delete;
+    FrameStore& operator=(const FrameStore&) = delete;
+
+private:
+    FrameStore() = default;
+
+    struct Key {
+        std::uint64_t hash;
+        unsigned int scale;
+
+        bool operator==(const Key& other) const { return hash == other.hash && scale == other.scale; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return static_cast<size_t>(key.hash ^ key.scale); }
+    };
+
+    void pruneExpired();
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, std::weak_ptr<AnimationFrame>, KeyHash> frames;
+    size_t pruneThreshold = 64;
+    std::map<std::string, DirectoryStats> directories;   // Sorted for the report
+};
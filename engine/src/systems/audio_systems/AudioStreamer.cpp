@@ -0,0 +1,297 @@
+#include "AudioStreamer.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace Engine {
+
+namespace {
+    // Longest the streamer sleeps without a wake (covers a missed notify)
+    constexpr auto IDLE_WAIT = std::chrono::milliseconds(10);
+
+    // Played while a stream's queue is empty; 512 frames of up to 8 channels
+    const sf::Int16 SILENCE[512 * 8] = {};
+    constexpr std::size_t SILENCE_FRAMES = 512;
+}
+
+AudioStreamer& AudioStreamer::getInstance() {
+    static AudioStreamer instance;
+    return instance;
+}
+
+AudioStreamer::AudioStreamer()
+    : wakeRequested(false)
+    , stopping(false)
+{
+    worker = std::thread(&AudioStreamer::workerLoop, this);
+}
+
+AudioStreamer::~AudioStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    worker.join();
+}
+
+void AudioStreamer::add(StreamedMusic& stream) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        streams.push_back(&stream);
+    }
+    wake();
+}
+
+void AudioStreamer::remove(StreamedMusic& stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    streams.erase(std::remove(streams.begin(), streams.end(), &stream), streams.end());
+}
+
+void AudioStreamer::wake() {
+    // Called from SFML's streaming threads: no lock, so they never wait for
+    // a decode; a notify lost to the race is picked up after IDLE_WAIT
+    wakeRequested = true;
+    wakeCondition.notify_one();
+}
+
+std::unique_ptr<StreamBuffer> AudioStreamer::acquireBuffer() {
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (!pool.empty()) {
+            auto buffer = std::move(pool.back());
+            pool.pop_back();
+            return buffer;
+        }
+    }
+    auto buffer = std::make_unique<StreamBuffer>();
+    buffer->samples.resize(BUFFER_SAMPLES);
+    return buffer;
+}
+
+void AudioStreamer::releaseBuffer(std::unique_ptr<StreamBuffer> buffer) {
+    if (!buffer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (pool.size() < MAX_POOLED) {
+        buffer->count = 0;
+        pool.push_back(std::move(buffer));
+    }
+}
+
+std::size_t AudioStreamer::getPooledBuffers() const {
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return pool.size();
+}
+
+void AudioStreamer::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        // One buffer per stream per pass, so a stream that was just
+        // opened can't starve one that is playing
+        bool worked = false;
+        for (StreamedMusic* stream : streams) {
+            worked |= stream->decodeNext();
+        }
+        if (!worked) {
+            wakeCondition.wait_for(lock, IDLE_WAIT, [this] { return stopping || wakeRequested.load(); });
+            wakeRequested = false;
+        }
+    }
+}
+
+StreamedMusic::StreamedMusic()
+    : queueTarget(2)
+    , looping(false)
+    , underruns(0)
+    , decoderEnded(true)
+    , generation(0)
+    , endOfStream(true)
+    , registered(false)
+{
+}
+
+StreamedMusic::~StreamedMusic() {
+    // SFML's thread must be gone before the queue it reads from
+    stop();
+    if (registered) {
+        AudioStreamer::getInstance().remove(*this);
+    }
+    clearQueue();
+}
+
+bool StreamedMusic::open(const std::string& path) {
+    stop();
+    auto& streamer = AudioStreamer::getInstance();
+    if (registered) {
+        streamer.remove(*this);
+        registered = false;
+    }
+    clearQueue();
+
+    file = VirtualFileSystem::getInstance().open(path);
+    if (!file) {
+        std::cerr << "StreamedMusic: Music not found: " << path << std::endl;
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(decoderMutex);
+        if (!decoder.openFromMemory(file.data(), file.size())) {
+            std::cerr << "StreamedMusic: Failed to open " << path << std::endl;
+            file = AssetFile();
+            return false;
+        }
+        decoderEnded = false;
+    }
+
+    unsigned int channels = decoder.getChannelCount();
+    unsigned int sampleRate = decoder.getSampleRate();
+    duration = decoder.getDuration();
+    initialize(channels, sampleRate);
+
+    // Read-ahead follows the decoded bitrate
+    double samplesAhead = static_cast<double>(AudioStreamer::READ_AHEAD) * sampleRate * channels;
+    queueTarget = std::max<std::size_t>(2, static_cast<std::size_t>(std::ceil(samplesAhead / AudioStreamer::BUFFER_SAMPLES)));
+    underruns = 0;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        endOfStream = false;
+    }
+
+    TSS_LOG_DEBUG("StreamedMusic", "Opened", field("path", path), field("channels", channels),
+                  field("rate", sampleRate), field("seconds", duration.asSeconds()),
+                  field("queueBuffers", queueTarget));
+
+    // Registered last: from here on the streamer fills the queue
+    streamer.add(*this);
+    registered = true;
+    return true;
+}
+
+void StreamedMusic::setLooping(bool loop) {
+    looping = loop;
+    if (loop) {
+        // A finished decoder can carry on from the start
+        std::lock_guard<std::mutex> lock(decoderMutex);
+        if (decoderEnded && file) {
+            decoder.seek(sf::Uint64(0));
+            decoderEnded = false;
+            std::lock_guard<std::mutex> queueLock(queueMutex);
+            endOfStream = false;
+        }
+        AudioStreamer::getInstance().wake();
+    }
+}
+
+bool StreamedMusic::decodeNext() {
+    std::lock_guard<std::mutex> decoderLock(decoderMutex);
+    std::uint64_t decodeGeneration;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (decoderEnded || ready.size() >= queueTarget) {
+            return false;
+        }
+        decodeGeneration = generation;
+    }
+
+    auto& streamer = AudioStreamer::getInstance();
+    auto buffer = streamer.acquireBuffer();
+    const unsigned int channels = std::max(1u, getChannelCount());
+    const std::size_t capacity = buffer->samples.size() - buffer->samples.size() % channels;
+    std::size_t count = 0;
+    bool restarted = false;
+    while (count < capacity) {
+        std::size_t read = static_cast<std::size_t>(decoder.read(buffer->samples.data() + count, capacity - count));
+        count += read;
+        if (count == capacity) {
+            break;
+        }
+        // End of the file: carry on from the start when looping (unless
+        // the file gives nothing at all)
+        if (!looping || (restarted && read == 0)) {
+            decoderEnded = true;
+            break;
+        }
+        decoder.seek(sf::Uint64(0));
+        restarted = true;
+    }
+    buffer->count = count;
+
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (decodeGeneration != generation) {
+        // Seeked while decoding
+        streamer.releaseBuffer(std::move(buffer));
+        return true;
+    }
+    if (count > 0) {
+        ready.push_back(std::move(buffer));
+    } else {
+        streamer.releaseBuffer(std::move(buffer));
+    }
+    if (decoderEnded) {
+        endOfStream = true;
+    }
+    return true;
+}
+
+bool StreamedMusic::onGetData(Chunk& data) {
+    auto& streamer = AudioStreamer::getInstance();
+    std::unique_ptr<StreamBuffer> finished;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        finished = std::move(playing);
+        if (!ready.empty()) {
+            playing = std::move(ready.front());
+            ready.pop_front();
+            data.samples = playing->samples.data();
+            data.sampleCount = playing->count;
+        } else if (endOfStream) {
+            streamer.releaseBuffer(std::move(finished));
+            return false;
+        } else {
+            ++underruns;
+            data.samples = SILENCE;
+            data.sampleCount = SILENCE_FRAMES * std::min(8u, getChannelCount());
+        }
+    }
+    streamer.releaseBuffer(std::move(finished));
+    streamer.wake();
+    return true;
+}
+
+void StreamedMusic::onSeek(sf::Time timeOffset) {
+    {
+        std::lock_guard<std::mutex> decoderLock(decoderMutex);
+        if (!file) {
+            return;
+        }
+        decoder.seek(timeOffset);
+        decoderEnded = false;
+
+        std::lock_guard<std::mutex> lock(queueMutex);
+        ++generation;
+        endOfStream = false;
+    }
+    clearQueue();
+    AudioStreamer::getInstance().wake();
+}
+
+void StreamedMusic::clearQueue() {
+    std::deque<std::unique_ptr<StreamBuffer>> stale;
+    std::unique_ptr<StreamBuffer> stalePlaying;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stale.swap(ready);
+        stalePlaying = std::move(playing);
+    }
+    auto& streamer = AudioStreamer::getInstance();
+    for (auto& buffer : stale) {
+        streamer.releaseBuffer(std::move(buffer));
+    }
+    streamer.releaseBuffer(std::move(stalePlaying));
+}
+
+} // namespace Engine
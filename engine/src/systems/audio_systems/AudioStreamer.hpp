@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../../resources/VirtualFileSystem.hpp"
+#include <SFML/Audio.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+// A block of decoded samples from AudioStreamer's shared pool
+struct StreamBuffer {
+    std::vector<sf::Int16> samples;
+    std::size_t count = 0;        // Valid samples (interleaved)
+};
+
+class StreamedMusic;
+
+// The one thread that reads and decodes every streamed audio source. Each
+// StreamedMusic keeps a queue of decoded buffers about READ_AHEAD seconds
+// long (so stereo 48 kHz streams hold more buffers than mono 22 kHz ones);
+// the streamer tops the queues up, one buffer per stream per pass, from a
+// pool shared by all streams.
+//
+// SFML still runs a small thread per playing sf::SoundStream to feed
+// OpenAL, but those only hand over buffers that are already decoded; file
+// reads and OGG decoding all happen here.
+class AudioStreamer {
+public:
+    static AudioStreamer& getInstance();
+
+    static constexpr std::size_t BUFFER_SAMPLES = 8192;     // Per pooled buffer, interleaved
+    static constexpr float READ_AHEAD = 0.75f;              // Seconds decoded ahead per stream
+
+    void add(StreamedMusic& stream);
+    // Blocks until the streamer is not decoding for `stream`
+    void remove(StreamedMusic& stream);
+    void wake();
+
+    std::unique_ptr<StreamBuffer> acquireBuffer();
+    void releaseBuffer(std::unique_ptr<StreamBuffer> buffer);
+    std::size_t getPooledBuffers() const;
+
+    AudioStreamer(const AudioStreamer&) = delete;
+    AudioStreamer& operator=(const AudioStreamer&) = delete;
+
+private:
+    AudioStreamer();
+    ~AudioStreamer();
+
+    void workerLoop();
+
+    static constexpr std::size_t MAX_POOLED = 64;
+
+    std::mutex mutex;                        // Streams; held while decoding
+    std::condition_variable wakeCondition;
+    std::vector<StreamedMusic*> streams;
+    std::atomic<bool> wakeRequested;
+    bool stopping;
+
+    mutable std::mutex poolMutex;
+    std::vector<std::unique_ptr<StreamBuffer>> pool;
+
+    std::thread worker;
+};
+
+// Music streamed through AudioStreamer: a drop-in for sf::Music that only
+// consumes pre-decoded buffers on SFML's side. Looping is done by the
+// decoder, so the loop point needs no refill. When the queue runs dry the
+// stream plays a short silence instead of stopping and counts an underrun.
+class StreamedMusic : public sf::SoundStream {
+public:
+    StreamedMusic();
+    ~StreamedMusic() override;
+
+    // From the virtual file system; the asset stays mapped while open
+    bool open(const std::string& path);
+
+    // Use instead of sf::SoundStream::setLoop
+    void setLooping(bool loop);
+    bool isLooping() const { return looping; }
+    sf::Time getDuration() const { return duration; }
+
+    // Times playback found no decoded data since open()
+    std::uint64_t getUnderruns() const { return underruns.load(); }
+
+    StreamedMusic(const StreamedMusic&) = delete;
+    StreamedMusic& operator=(const StreamedMusic&) = delete;
+
+protected:
+    bool onGetData(Chunk& data) override;
+    void onSeek(sf::Time timeOffset) override;
+
+private:
+    friend class AudioStreamer;
+
+    // Streamer thread: decodes one buffer if the queue is short; returns
+    // whether it did any work
+    bool decodeNext();
+    void clearQueue();
+
+    AssetFile file;
+    sf::Time duration;
+    std::size_t queueTarget;                 // Buffers for READ_AHEAD seconds
+    std::atomic<bool> looping;
+    std::atomic<std::uint64_t> underruns;
+
+    // Decoder: streamer thread, or onSeek() with SFML's thread stopped
+    std::mutex decoderMutex;
+    sf::InputSoundFile decoder;
+    bool decoderEnded;
+
+    // Queue: shared with SFML's streaming thread
+    std::mutex queueMutex;
+    std::deque<std::unique_ptr<StreamBuffer>> ready;
+    std::unique_ptr<StreamBuffer> playing;   // Owned by OpenAL until the next onGetData
+    std::uint64_t generation;                // Bumped by seeks; drops stale buffers
+    bool endOfStream;                        // Everything decoded is queued
+    bool registered;
+};
+
+} // namespace Engine
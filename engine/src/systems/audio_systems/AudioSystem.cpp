@@ -1,67 +1,65 @@
 #include "AudioSystem.hpp"
-#include "../../config/AssetPaths.hpp"
-#include <fstream>
-#include <filesystem>
+#include "../../core/Logger.hpp"
+#include "../../resources/ResourceManager.hpp"
+#include <algorithm>
+#include <iostream>
 
 namespace Engine {
 
+namespace {
+    // Interval between volume steps while a sound fades (50 per second)
+    constexpr double FADE_STEP = 1.0 / 50.0;
+
+    // Root of the bus tree; buses without a parent hang off it
+    const std::string MASTER_BUS = "master";
+    constexpr BusId MASTER_ID = 0;
+}
+
+AudioSystem::AudioSystem() {
+    // Music streams die with this instance, so the streamer they use must
+    // be created first (and so destroyed last)
+    AudioStreamer::getInstance();
+}
+
 void AudioSystem::initialize(const std::string& configPath) {
-    std::cout << "AudioSystem: Loading config from absolute path: " << configPath << std::endl;
+    TSS_LOG_INFO("AudioSystem", "Loading config", field("path", configPath));
     
-    // Load configuration
-    std::ifstream configFile(configPath);
-    if (!configFile.is_open()) {
-        std::cerr << "Failed to open audio config file: " << configPath << std::endl;
-        return;
-    }
+    auto& resources = ResourceManager::getInstance();
     
     // Clear existing audio data
     sounds.clear();
     music.clear();
-    categoryVolumes.clear();
+    buses.clear();
+    busIds.clear();
     
     try {
-        config = nlohmann::json::parse(configFile);
+        if (!resources.loadJson(config, configPath)) {
+            std::cerr << "Failed to open audio config file: " << configPath << std::endl;
+            return;
+        }
         if (!config.is_object()) {
             std::cerr << "Invalid audio config format: Root must be an object" << std::endl;
             return;
         }
-        std::cout << "AudioSystem: Successfully parsed config file" << std::endl;
-        
-        // Debug print entire config
-        std::cout << "AudioSystem: Full config contents:" << std::endl;
-        std::cout << config.dump(2) << std::endl;
+        TSS_LOG_DEBUG("AudioSystem", "Parsed config",
+                      field("sounds", config.contains("sounds") ? config["sounds"].size() : 0),
+                      field("music", config.contains("music") ? config["music"].size() : 0));
         
-        // Initialize category volumes
-        if (!config.contains("categories")) {
-            std::cerr << "Audio config missing 'categories' section" << std::endl;
-            return;
-        }
-        
-        for (const auto& [category, data] : config["categories"].items()) {
-            if (!data.contains("volume")) {
-                std::cerr << "Category " << category << " missing volume setting" << std::endl;
-                continue;
-            }
-            float volume = data["volume"].get<float>();
-            categoryVolumes[category] = volume;
-            std::cout << "AudioSystem: Category '" << category << "' volume initialized to " << volume << std::endl;
-        }
+        // Build the mixer bus tree
+        loadBuses();
         
         // Load sounds
         if (config.contains("sounds")) {
             for (const auto& [name, data] : config["sounds"].items()) {
                 SoundData soundData;
-                std::string filePath = AssetPaths::resolvePath(data["file"].get<std::string>());
-                std::cout << "AudioSystem: Loading sound '" << name << "' from " << filePath << std::endl;
-                
+                std::string filePath = data["file"].get<std::string>();
                 // Verify file exists
-                if (!std::filesystem::exists(filePath)) {
+                if (!VirtualFileSystem::getInstance().exists(filePath)) {
                     std::cerr << "AudioSystem: Sound file does not exist: " << filePath << std::endl;
                     continue;
                 }
                 
-                if (!soundData.buffer.loadFromFile(filePath)) {
+                if (!resources.loadSoundBuffer(soundData.buffer, filePath)) {
                     std::cerr << "Failed to load sound: " << filePath << std::endl;
                     continue;
                 }
@@ -84,30 +82,25 @@ void AudioSystem::initialize(const std::string& configPath) {
                 soundData.baseVolume = data["base_volume"];
                 soundData.currentVolume = soundData.baseVolume;
                 soundData.targetVolume = soundData.baseVolume;
-                soundData.category = data["category"];
                 
-                std::cout << "AudioSystem: Sound '" << name << "' loaded successfully:" << std::endl;
-                std::cout << "  - File: " << filePath << std::endl;
-                std::cout << "  - Duration: " << soundData.buffer.getDuration().asSeconds() << "s" << std::endl;
-                std::cout << "  - Sample Count: " << soundData.buffer.getSampleCount() << std::endl;
-                std::cout << "  - Channel Count: " << soundData.buffer.getChannelCount() << std::endl;
-                std::cout << "  - Sample Rate: " << soundData.buffer.getSampleRate() << " Hz" << std::endl;
+                // Store the sound data; the bus links to the map node
+                SoundData& stored = sounds[name] = std::move(soundData);
+                attachVoice(stored, resolveBus(data, name));
+                updateSoundProperties(stored);
+                float finalVolume = stored.sound.getVolume();
                 
-                // Apply initial volume based on category
-                if (auto it = categoryVolumes.find(soundData.category); it != categoryVolumes.end()) {
-                    float finalVolume = (soundData.baseVolume * it->second) / 100.f;
-                    soundData.sound.setVolume(finalVolume);
-                    std::cout << "  - Initial Volume: " << finalVolume << std::endl;
-                }
-                
-                // Store the sound data
-                sounds[name] = std::move(soundData);
+                TSS_LOG_DEBUG("AudioSystem", "Loaded sound",
+                              field("name", name),
+                              field("file", filePath),
+                              field("bus", getBusName(stored.bus)),
+                              field("seconds", stored.buffer.getDuration().asSeconds()),
+                              field("channels", stored.buffer.getChannelCount()),
+                              field("rate", stored.buffer.getSampleRate()),
+                              field("volume", finalVolume));
                 
                 // Verify sound was stored correctly
-                if (auto it = sounds.find(name); it != sounds.end()) {
-                    if (!it->second.sound.getBuffer()) {
-                        std::cerr << "AudioSystem: Error - Buffer lost after storing sound!" << std::endl;
-                    }
+                if (!stored.sound.getBuffer()) {
+                    std::cerr << "AudioSystem: Error - Buffer lost after storing sound!" << std::endl;
                 }
             }
         }
@@ -116,39 +109,30 @@ void AudioSystem::initialize(const std::string& configPath) {
         if (config.contains("music")) {
             for (const auto& [name, data] : config["music"].items()) {
                 auto musicPtr = std::make_unique<MusicData>();
-                std::string filePath = AssetPaths::resolvePath(data["file"].get<std::string>());
-                std::cout << "AudioSystem: Loading music '" << name << "' from " << filePath << std::endl;
-                
-                if (!musicPtr->music.openFromFile(filePath)) {
+                std::string filePath = data["file"].get<std::string>();
+                if (!musicPtr->music.open(filePath)) {
                     std::cerr << "Failed to load music: " << filePath << std::endl;
                     continue;
                 }
                 
                 musicPtr->baseVolume = data["base_volume"];
-                musicPtr->category = data["category"];
+                musicPtr->isMusic = true;
                 
-                std::cout << "AudioSystem: Music '" << name << "' base volume: " << musicPtr->baseVolume 
-                         << ", category: " << musicPtr->category << std::endl;
-                
-                // Apply initial volume based on category
-                if (auto it = categoryVolumes.find(musicPtr->category); it != categoryVolumes.end()) {
-                    float finalVolume = (musicPtr->baseVolume * it->second) / 100.f;
-                    musicPtr->music.setVolume(finalVolume);
-                    std::cout << "AudioSystem: Setting initial music '" << name 
-                             << "' volume to " << finalVolume 
-                             << " (base: " << musicPtr->baseVolume 
-                             << " * category: " << it->second << ")" << std::endl;
-                } else {
-                    std::cerr << "Warning: Music '" << name << "' has unknown category: " 
-                             << musicPtr->category << std::endl;
-                }
+                // Apply initial volume from its bus
+                attachVoice(*musicPtr, resolveBus(data, name));
+                updateMusicVolume(*musicPtr);
+                TSS_LOG_DEBUG("AudioSystem", "Initial music volume",
+                              field("name", name),
+                              field("volume", musicPtr->music.getVolume()),
+                              field("base", musicPtr->baseVolume),
+                              field("bus", getBusName(musicPtr->bus)));
                 
                 if (data.contains("loop")) {
-                    musicPtr->music.setLoop(data["loop"]);
+                    musicPtr->music.setLooping(data["loop"]);
                 }
                 
                 music[name] = std::move(musicPtr);
-                std::cout << "AudioSystem: Successfully loaded music '" << name << "'" << std::endl;
+                TSS_LOG_DEBUG("AudioSystem", "Loaded music", field("name", name), field("file", filePath));
             }
         }
         
@@ -160,82 +144,52 @@ void AudioSystem::initialize(const std::string& configPath) {
         return;
     }
     
-    // Final verification of loaded data
-    std::cout << "\nAudioSystem: Initialization Summary:" << std::endl;
-    std::cout << "Categories loaded: " << categoryVolumes.size() << std::endl;
-    for (const auto& [category, volume] : categoryVolumes) {
-        std::cout << "  - " << category << ": " << volume << std::endl;
-    }
-    std::cout << "Sounds loaded: " << sounds.size() << std::endl;
-    std::cout << "Music tracks loaded: " << music.size() << std::endl;
+    TSS_LOG_INFO("AudioSystem", "Initialized",
+                 field("buses", buses.size()),
+                 field("sounds", sounds.size()),
+                 field("music", music.size()));
 }
 
 void AudioSystem::playSound(const std::string& name) {
-    if (debugEnabled) std::cout << "AudioSystem: Attempting to play sound '" << name << "'" << std::endl;
-    
     if (auto it = sounds.find(name); it != sounds.end()) {
-        if (debugEnabled) std::cout << "AudioSystem: Found sound '" << name << "' in loaded sounds" << std::endl;
-        
         // Verify buffer is valid
         if (!it->second.buffer.getSampleCount()) {
             std::cerr << "AudioSystem: Error - Sound buffer is empty!" << std::endl;
             return;
         }
         
-        // Print current sound properties if debug enabled
-        if (debugEnabled) {
-            std::cout << "AudioSystem: Sound properties before play:" << std::endl;
-            std::cout << "  - Base Volume: " << it->second.baseVolume << std::endl;
-            std::cout << "  - Current Volume: " << it->second.currentVolume << std::endl;
-            std::cout << "  - Category: " << it->second.category << std::endl;
-            std::cout << "  - Buffer Duration: " << it->second.buffer.getDuration().asSeconds() << "s" << std::endl;
-            std::cout << "  - Buffer Sample Count: " << it->second.buffer.getSampleCount() << std::endl;
-            std::cout << "  - Buffer Channel Count: " << it->second.buffer.getChannelCount() << std::endl;
-        }
-        
         // Verify sound has buffer attached
         if (!it->second.sound.getBuffer()) {
             std::cerr << "AudioSystem: Error - Sound has no buffer attached!" << std::endl;
             // Try re-attaching buffer
             it->second.sound.setBuffer(it->second.buffer);
-            if (debugEnabled) std::cout << "AudioSystem: Re-attached buffer to sound" << std::endl;
+            if (debugEnabled) TSS_LOG_DEBUG("AudioSystem", "Re-attached buffer", field("name", name));
         }
         
         // Update volume before playing
         updateSoundProperties(it->second);
         
-        // Print final volume and status if debug enabled
-        if (debugEnabled) {
-            std::cout << "AudioSystem: Final volume after properties update: " << it->second.sound.getVolume() << std::endl;
-            std::cout << "AudioSystem: Sound buffer address: " << &(it->second.buffer) << std::endl;
-            std::cout << "AudioSystem: Sound object address: " << &(it->second.sound) << std::endl;
-        }
-        
         // Play the sound
         it->second.sound.play();
-        if (debugEnabled) std::cout << "AudioSystem: Started playing sound '" << name << "'" << std::endl;
+        if (debugEnabled) {
+            TSS_LOG_DEBUG("AudioSystem", "Playing sound",
+                          field("name", name),
+                          field("bus", getBusName(it->second.bus)),
+                          field("base", it->second.baseVolume),
+                          field("volume", it->second.sound.getVolume()));
+        }
         
     } else {
         std::cerr << "AudioSystem: Sound '" << name << "' not found in loaded sounds!" << std::endl;
-        if (debugEnabled) {
-            std::cout << "AudioSystem: Currently loaded sounds:" << std::endl;
-            for (const auto& [soundName, _] : sounds) {
-                std::cout << "  - " << soundName << std::endl;
-            }
-        }
     }
 }
 
 void AudioSystem::playMusic(const std::string& name) {
-    std::cout << "AudioSystem: Attempting to play music " << name << std::endl;
     if (auto it = music.find(name); it != music.end()) {
         // Update volume before playing
-        if (auto catIt = categoryVolumes.find(it->second->category); catIt != categoryVolumes.end()) {
-            float finalVolume = (it->second->baseVolume * catIt->second) / 100.f;
-            it->second->music.setVolume(finalVolume);
-        }
+        updateMusicVolume(*it->second);
         it->second->music.play();
-        std::cout << "AudioSystem: Started playing music " << name << std::endl;
+        TSS_LOG_DEBUG("AudioSystem", "Playing music", field("name", name));
     } else {
         std::cerr << "AudioSystem: Music " << name << " not found!" << std::endl;
     }
@@ -248,10 +202,9 @@ void AudioSystem::stopSound(const std::string& name) {
 }
 
 void AudioSystem::stopMusic(const std::string& name) {
-    std::cout << "AudioSystem: Attempting to stop music " << name << std::endl;
     if (auto it = music.find(name); it != music.end()) {
         it->second->music.stop();
-        std::cout << "AudioSystem: Stopped music " << name << std::endl;
+        TSS_LOG_DEBUG("AudioSystem", "Stopped music", field("name", name));
     } else {
         std::cerr << "AudioSystem: Music " << name << " not found!" << std::endl;
     }
@@ -275,27 +228,148 @@ void AudioSystem::setPlayerRotation(float angle) {
     }
 }
 
-void AudioSystem::setCategoryVolume(const std::string& category, float volume) {
-    // Only clamp volume to prevent negative values
-    float clampedVolume = std::max(0.f, volume);
-    categoryVolumes[category] = clampedVolume;
+void AudioSystem::loadBuses() {
+    addBus(MASTER_BUS, 100.f);
     
-    // Update all sounds in this category
-    for (auto& [name, soundData] : sounds) {
-        if (soundData.category == category) {
-            updateSoundProperties(soundData);
+    // Configs from before the bus tree only list flat categories
+    const char* section = config.contains("buses") ? "buses" : "categories";
+    if (!config.contains(section)) {
+        std::cerr << "Audio config missing 'buses' section" << std::endl;
+        return;
+    }
+    const auto& layout = config[section];
+    
+    // Create every bus before linking: a parent may be listed after its children
+    for (const auto& [name, data] : layout.items()) {
+        float volume = data.value("volume", 100.f);
+        if (name == MASTER_BUS) {
+            buses[MASTER_ID].volume = volume;
+        } else {
+            addBus(name, volume);
         }
     }
     
-    // Update all music in this category
-    for (auto& [name, musicPtr] : music) {
-        if (musicPtr->category == category) {
-            float finalVolume = (musicPtr->baseVolume * clampedVolume) / 100.f;
-            musicPtr->music.setVolume(finalVolume);
+    for (const auto& [name, data] : layout.items()) {
+        BusId id = busIds[name];
+        if (id == MASTER_ID) {
+            continue;
+        }
+        BusId parent = MASTER_ID;
+        std::string parentName = data.value("parent", MASTER_BUS);
+        if (auto it = busIds.find(parentName); it != busIds.end()) {
+            parent = it->second;
+        } else {
+            std::cerr << "AudioSystem: Bus '" << name << "' has unknown parent '" << parentName << "'" << std::endl;
         }
+        // A parent below this bus would close a cycle
+        for (BusId ancestor = parent; ancestor != NO_BUS; ancestor = buses[ancestor].parent) {
+            if (ancestor == id) {
+                std::cerr << "AudioSystem: Bus '" << name << "' is its own ancestor" << std::endl;
+                parent = MASTER_ID;
+                break;
+            }
+        }
+        buses[id].parent = parent;
+        buses[parent].children.push_back(id);
+    }
+    
+    updateGains(MASTER_ID);
+    for (const auto& bus : buses) {
+        TSS_LOG_DEBUG("AudioSystem", "Bus", field("name", bus.name),
+                      field("parent", getBusName(bus.parent)), field("volume", bus.volume));
     }
 }
 
+BusId AudioSystem::addBus(const std::string& name, float volume) {
+    BusId id = static_cast<BusId>(buses.size());
+    Bus bus;
+    bus.name = name;
+    bus.volume = volume;
+    buses.push_back(std::move(bus));
+    busIds[name] = id;
+    return id;
+}
+
+BusId AudioSystem::resolveBus(const nlohmann::json& data, const std::string& voiceName) const {
+    // "category" is the pre-bus name of the field
+    const char* key = data.contains("bus") ? "bus" : "category";
+    std::string name = data.value(key, MASTER_BUS);
+    BusId bus = getBusId(name);
+    if (bus == NO_BUS) {
+        std::cerr << "Warning: '" << voiceName << "' has unknown bus: " << name << std::endl;
+        return MASTER_ID;
+    }
+    return bus;
+}
+
+void AudioSystem::attachVoice(Voice& voice, BusId bus) {
+    voice.bus = bus;
+    voice.prevOnBus = nullptr;
+    voice.nextOnBus = buses[bus].voices;
+    if (voice.nextOnBus) {
+        voice.nextOnBus->prevOnBus = &voice;
+    }
+    buses[bus].voices = &voice;
+}
+
+BusId AudioSystem::getBusId(const std::string& name) const {
+    auto it = busIds.find(name);
+    return it != busIds.end() ? it->second : NO_BUS;
+}
+
+const std::string& AudioSystem::getBusName(BusId bus) const {
+    static const std::string none;
+    return bus < buses.size() ? buses[bus].name : none;
+}
+
+float AudioSystem::getBusVolume(BusId bus) const {
+    return bus < buses.size() ? buses[bus].volume : 0.f;
+}
+
+void AudioSystem::setBusVolume(BusId bus, float volume) {
+    if (bus >= buses.size()) {
+        return;
+    }
+    buses[bus].volume = volume;
+    updateGains(bus);
+}
+
+void AudioSystem::updateGains(BusId id) {
+    Bus& bus = buses[id];
+    float parentGain = bus.parent == NO_BUS ? 1.f : buses[bus.parent].gain;
+    // Only prevent negative values, allow volumes above 100
+    bus.gain = std::max(0.f, bus.volume) / 100.f * parentGain;
+    
+    for (Voice* voice = bus.voices; voice; voice = voice->nextOnBus) {
+        applyGain(*voice);
+    }
+    for (BusId child : bus.children) {
+        updateGains(child);
+    }
+}
+
+void AudioSystem::applyGain(Voice& voice) {
+    if (voice.isMusic) {
+        updateMusicVolume(static_cast<MusicData&>(voice));
+    } else {
+        updateSoundProperties(static_cast<SoundData&>(voice));
+    }
+}
+
+void AudioSystem::updateMusicVolume(MusicData& musicData) {
+    float gain = musicData.bus == NO_BUS ? 1.f : buses[musicData.bus].gain;
+    musicData.music.setVolume(musicData.baseVolume * gain);
+}
+
+void AudioSystem::setCategoryVolume(const std::string& category, float volume) {
+    BusId bus = getBusId(category);
+    if (bus == NO_BUS) {
+        std::cerr << "AudioSystem: Unknown bus: " << category << std::endl;
+        return;
+    }
+    setBusVolume(bus, volume);
+}
+
 void AudioSystem::setSoundVolume(const std::string& name, float volume) {
     if (auto it = sounds.find(name); it != sounds.end()) {
         it->second.baseVolume = volume;
@@ -305,48 +379,54 @@ void AudioSystem::setSoundVolume(const std::string& name, float volume) {
 
 void AudioSystem::fadeIn(const std::string& name, float duration) {
     if (auto it = sounds.find(name); it != sounds.end()) {
-        it->second.fading = true;
-        it->second.fadeTime = 0.f;
-        it->second.fadeDuration = duration;
-        it->second.fadeStartVolume = 0.f;
-        it->second.fadeTargetVolume = it->second.baseVolume;
-        it->second.sound.setVolume(0.f);
+        startFade(it->second, duration, 0.f, it->second.baseVolume);
         it->second.sound.play();
     }
 }
 
 void AudioSystem::fadeOut(const std::string& name, float duration) {
     if (auto it = sounds.find(name); it != sounds.end()) {
-        it->second.fading = true;
-        it->second.fadeTime = 0.f;
-        it->second.fadeDuration = duration;
-        it->second.fadeStartVolume = it->second.currentVolume;
-        it->second.fadeTargetVolume = 0.f;
+        startFade(it->second, duration, it->second.currentVolume, 0.f);
     }
 }
 
-void AudioSystem::update(float deltaTime) {
-    // Update fading sounds
-    for (auto& [name, soundData] : sounds) {
-        if (soundData.fading) {
-            soundData.fadeTime += deltaTime;
-            
-            if (soundData.fadeTime >= soundData.fadeDuration) {
-                soundData.fading = false;
-                soundData.currentVolume = soundData.fadeTargetVolume;
-                if (soundData.fadeTargetVolume <= 0.f) {
-                    soundData.sound.stop();
-                }
-            } else {
-                float t = soundData.fadeTime / soundData.fadeDuration;
-                soundData.currentVolume = soundData.fadeStartVolume + 
-                    (soundData.fadeTargetVolume - soundData.fadeStartVolume) * t;
-            }
-            
-            updateSoundProperties(soundData);
+void AudioSystem::startFade(SoundData& soundData, float duration, float from, float to) {
+    auto& timers = TimerWheel::getInstance();
+    timers.cancel(soundData.fadeTimer);
+
+    soundData.fading = true;
+    soundData.fadeStart = timers.getTime();
+    soundData.fadeDuration = duration;
+    soundData.fadeStartVolume = from;
+    soundData.fadeTargetVolume = to;
+    soundData.currentVolume = from;
+    updateSoundProperties(soundData);
+
+    // Map nodes never move, so the timer can hold on to the entry
+    SoundData* data = &soundData;
+    soundData.fadeTimer = timers.scheduleRepeating(FADE_STEP, [this, data] { stepFade(*data); });
+}
+
+void AudioSystem::stepFade(SoundData& soundData) {
+    float elapsed = static_cast<float>(TimerWheel::getInstance().getTime() - soundData.fadeStart);
+
+    if (elapsed >= soundData.fadeDuration) {
+        soundData.fading = false;
+        soundData.currentVolume = soundData.fadeTargetVolume;
+        if (soundData.fadeTargetVolume <= 0.f) {
+            soundData.sound.stop();
         }
+        TimerWheel::getInstance().cancel(soundData.fadeTimer);
+    } else {
+        float t = elapsed / soundData.fadeDuration;
+        soundData.currentVolume = soundData.fadeStartVolume + 
+            (soundData.fadeTargetVolume - soundData.fadeStartVolume) * t;
     }
 
+    updateSoundProperties(soundData);
+}
+
+void AudioSystem::update(float) {
     // Check for status changes and notify callbacks
     checkAndNotifyStatusChanges();
 }
@@ -362,6 +442,10 @@ void AudioSystem::checkAndNotifyStatusChanges() {
             else if (currentStatus == sf::SoundSource::Stopped && onMusicStop) {
                 onMusicStop(name);
             }
+            if (currentStatus == sf::SoundSource::Stopped && musicPtr->music.getUnderruns() > 0) {
+                TSS_LOG_INFO("AudioSystem", "Music stream underran", field("name", name),
+                             field("underruns", musicPtr->music.getUnderruns()));
+            }
             musicPtr->lastStatus = currentStatus;
         }
     }
@@ -402,6 +486,13 @@ sf::SoundSource::Status AudioSystem::getMusicStatus(const std::string& name) con
     return sf::SoundSource::Stopped;
 }
 
+std::uint64_t AudioSystem::getMusicUnderruns(const std::string& name) const {
+    if (auto it = music.find(name); it != music.end()) {
+        return it->second->music.getUnderruns();
+    }
+    return 0;
+}
+
 sf::SoundSource::Status AudioSystem::getSoundStatus(const std::string& name) const {
     if (auto it = sounds.find(name); it != sounds.end()) {
         return it->second.sound.getStatus();
@@ -420,10 +511,9 @@ void AudioSystem::updateSoundProperties(SoundData& soundData) {
         finalVolume *= calculateVolume(relativeAngle, soundData.minVolume);
     }
     
-    // Apply category volume
-    if (auto it = categoryVolumes.find(soundData.category); it != categoryVolumes.end()) {
-        // Only prevent negative values, allow volumes above 100
-        finalVolume = std::max(0.f, (finalVolume * it->second) / 100.f);
+    // Apply the bus gain
+    if (soundData.bus != NO_BUS) {
+        finalVolume = std::max(0.f, finalVolume * buses[soundData.bus].gain);
     }
     
     soundData.sound.setVolume(finalVolume);
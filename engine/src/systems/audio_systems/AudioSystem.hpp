@@ -1,15 +1,28 @@
 #pragma once
 
+#include "AudioStreamer.hpp"
+#include "../../core/TimerWheel.hpp"
 #include <SFML/Audio.hpp>
 #include <nlohmann/json.hpp>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <memory>
 #include <cmath>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace Engine {
 
+using BusId = std::uint16_t;
+constexpr BusId NO_BUS = 0xFFFF;
+
+// Sounds and music play through a tree of mixer buses defined in
+// audio_config.json ("buses": name -> parent, volume). Each bus caches its
+// effective gain (the product of its volume and its ancestors'), and keeps
+// an intrusive list of the voices routed to it, so a volume change only
+// recomputes the subtree below the bus and touches only the voices on it.
 class AudioSystem {
 public:
     // Callback types
@@ -36,7 +49,11 @@ public:
     void updateVirtualPosition(const std::string& name, float angle);
     void setPlayerRotation(float angle); // Angle in degrees, 0 is forward
     
-    // Volume control
+    // Volume control. Bus ids stay valid until the next initialize();
+    // setCategoryVolume() is the by-name shorthand.
+    BusId getBusId(const std::string& name) const;
+    void setBusVolume(BusId bus, float volume);
+    float getBusVolume(BusId bus) const;
     void setCategoryVolume(const std::string& category, float volume);
     void setSoundVolume(const std::string& name, float volume);
     
@@ -44,7 +61,7 @@ public:
     void fadeIn(const std::string& name, float duration);
     void fadeOut(const std::string& name, float duration);
     
-    // Update system
+    // Update system (fades run on the main TimerWheel)
     void update(float deltaTime);
 
     // Audio state callbacks
@@ -54,13 +71,16 @@ public:
     void setSoundStopCallback(AudioCallback callback) { onSoundStop = callback; }
 
     // Audio state queries
+    bool hasSound(const std::string& name) const { return sounds.count(name) > 0; }
     bool isMusicPlaying(const std::string& name) const;
     bool isSoundPlaying(const std::string& name) const;
     sf::SoundSource::Status getMusicStatus(const std::string& name) const;
     sf::SoundSource::Status getSoundStatus(const std::string& name) const;
+    // Times the music's stream ran out of decoded audio
+    std::uint64_t getMusicUnderruns(const std::string& name) const;
 
 private:
-    AudioSystem() = default;
+    AudioSystem();
     ~AudioSystem() = default;
     AudioSystem(const AudioSystem&) = delete;
     AudioSystem& operator=(const AudioSystem&) = delete;
@@ -68,7 +88,24 @@ private:
     // Debug flag
     static inline bool debugEnabled = false;
 
-    struct SoundData {
+    // Intrusive node in a bus's voice list
+    struct Voice {
+        BusId bus = NO_BUS;
+        bool isMusic = false;     // SoundData or MusicData
+        Voice* prevOnBus = nullptr;
+        Voice* nextOnBus = nullptr;
+    };
+
+    struct Bus {
+        std::string name;
+        BusId parent = NO_BUS;
+        std::vector<BusId> children;
+        float volume = 100.f;     // Percent, as configured/set
+        float gain = 1.f;         // Effective: volume / 100 times the parent's gain
+        Voice* voices = nullptr;  // Head of the voice list
+    };
+
+    struct SoundData : Voice {
         sf::SoundBuffer buffer;
         sf::Sound sound;
         float baseVolume = 100.f;
@@ -77,33 +114,43 @@ private:
         float virtualAngle = 0.f;  // Angle relative to player's forward direction
         bool spatial = false;      // Whether sound uses virtual positioning
         float minVolume = 0.f;     // Minimum volume for spatial sounds
-        std::string category;
         bool fading = false;
-        float fadeTime = 0.f;
+        double fadeStart = 0.0;    // Wheel time the fade began
+        TimerHandle fadeTimer;
         float fadeDuration = 0.f;
         float fadeStartVolume = 0.f;
         float fadeTargetVolume = 0.f;
         sf::SoundSource::Status lastStatus = sf::SoundSource::Stopped;
     };
 
-    struct MusicData {
-        sf::Music music;
+    struct MusicData : Voice {
+        StreamedMusic music;
         float baseVolume = 100.f;
-        std::string category;
         sf::SoundSource::Status lastStatus = sf::SoundSource::Stopped;
     };
 
     // Helper functions
+    void loadBuses();
+    BusId addBus(const std::string& name, float volume);
+    BusId resolveBus(const nlohmann::json& data, const std::string& voiceName) const;
+    void attachVoice(Voice& voice, BusId bus);
+    void updateGains(BusId bus);
+    void applyGain(Voice& voice);
+    void updateMusicVolume(MusicData& musicData);
+    const std::string& getBusName(BusId bus) const;
     void updateSoundProperties(SoundData& soundData);
     float calculatePanning(float relativeAngle);
     float calculateVolume(float relativeAngle, float minVolume);
     float normalizeAngle(float angle);
     void checkAndNotifyStatusChanges();
+    void startFade(SoundData& soundData, float duration, float from, float to);
+    void stepFade(SoundData& soundData);
 
     nlohmann::json config;
     std::map<std::string, SoundData> sounds;
-    std::map<std::string, std::unique_ptr<MusicData>> music;
-    std::map<std::string, float> categoryVolumes;
+    std::map<std::string, std::unique_ptr<MusicData>> music;   // Map nodes and music never move
+    std::vector<Bus> buses;
+    std::unordered_map<std::string, BusId> busIds;
     
     float playerRotation = 0.f;  // Current player rotation in degrees
     const float PI = 3.14159265359f;
@@ -0,0 +1,167 @@
+#include "CameraSystem.hpp"
+#include "../../core/Logger.hpp"
+#include "../../resources/ResourceManager.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace Engine {
+
+CameraSystem::CameraSystem()
+    : feedSize(1280, 720)
+    , selected(Room::ShowStage)
+    , monitorOpen(false)
+    , renderCount(0)
+{
+    noise.setIntensity(0.35f);
+}
+
+CameraSystem& CameraSystem::getInstance() {
+    static CameraSystem instance;
+    return instance;
+}
+
+bool CameraSystem::addFeed(Room room, const std::string& backgroundPath) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!ResourceManager::getInstance().loadTexture(*texture, backgroundPath)) {
+        std::cerr << "CameraSystem: Failed to load feed background " << backgroundPath << std::endl;
+        return false;
+    }
+    Feed& feed = feeds[index(room)];
+    feed.background = std::move(texture);
+    feed.dirty = true;
+    return true;
+}
+
+bool CameraSystem::addPlaceholderFeed(Room room, const sf::Color& color) {
+    sf::Image image;
+    image.create(1, 1, color);
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->loadFromImage(image)) {
+        std::cerr << "CameraSystem: Failed to create placeholder feed" << std::endl;
+        return false;
+    }
+    Feed& feed = feeds[index(room)];
+    feed.background = std::move(texture);
+    feed.dirty = true;
+    return true;
+}
+
+bool CameraSystem::addOverlay(Room room, AnimatronicKind kind, const std::string& path) {
+    auto texture = std::make_unique<sf::Texture>();
+    if (!ResourceManager::getInstance().loadTexture(*texture, path)) {
+        std::cerr << "CameraSystem: Failed to load overlay " << path << std::endl;
+        return false;
+    }
+    Feed& feed = feeds[index(room)];
+    feed.overlays[static_cast<std::size_t>(kind)] = std::move(texture);
+    feed.dirty = true;
+    return true;
+}
+
+void CameraSystem::setFeedSize(unsigned int width, unsigned int height) {
+    if (feedSize == sf::Vector2u(width, height)) {
+        return;
+    }
+    feedSize = sf::Vector2u(width, height);
+    noise.setResolution(width, height);
+    for (Feed& feed : feeds) {
+        feed.target.reset();
+        feed.dirty = true;
+    }
+}
+
+void CameraSystem::selectFeed(Room room) {
+    if (!hasFeed(room)) {
+        return;
+    }
+    selected = room;
+}
+
+void CameraSystem::setLightLevel(Room room, float level) {
+    Feed& feed = feeds[index(room)];
+    level = std::clamp(level, 0.0f, 1.0f);
+    if (feed.lightLevel != level) {
+        feed.lightLevel = level;
+        feed.dirty = true;
+    }
+}
+
+void CameraSystem::updateOccupancy(const AgentData& agents) {
+    std::array<std::uint8_t, ROOM_COUNT> occupants{};
+    for (std::size_t i = 0; i < agents.size(); ++i) {
+        occupants[index(agents.room[i])] |= static_cast<std::uint8_t>(1u << static_cast<unsigned>(agents.kind[i]));
+    }
+    for (std::size_t r = 0; r < ROOM_COUNT; ++r) {
+        if (feeds[r].occupants != occupants[r]) {
+            feeds[r].occupants = occupants[r];
+            feeds[r].dirty = true;
+        }
+    }
+}
+
+void CameraSystem::render() {
+    if (!monitorOpen) {
+        return;
+    }
+    noise.update();
+
+    Feed& feed = feeds[index(selected)];
+    if (!feed.dirty || !feed.background) {
+        return;
+    }
+    if (renderFeed(feed)) {
+        feed.dirty = false;
+    }
+}
+
+bool CameraSystem::renderFeed(Feed& feed) {
+    if (!feed.target) {
+        feed.target = std::make_unique<sf::RenderTexture>();
+        if (!feed.target->create(feedSize.x, feedSize.y)) {
+            std::cerr << "CameraSystem: Failed to create " << feedSize.x << "x" << feedSize.y
+                      << " feed texture" << std::endl;
+            feed.target.reset();
+            return false;
+        }
+    }
+
+    // Lighting tints every layer the same way
+    auto shade = static_cast<sf::Uint8>(255.0f * feed.lightLevel);
+    sf::Color tint(shade, shade, shade);
+
+    auto drawLayer = [&](const sf::Texture& texture) {
+        sf::Sprite sprite(texture);
+        sprite.setScale(static_cast<float>(feedSize.x) / static_cast<float>(texture.getSize().x),
+                        static_cast<float>(feedSize.y) / static_cast<float>(texture.getSize().y));
+        sprite.setColor(tint);
+        feed.target->draw(sprite);
+    };
+
+    feed.target->clear(sf::Color::Black);
+    drawLayer(*feed.background);
+    for (std::size_t k = 0; k < ANIMATRONIC_KIND_COUNT; ++k) {
+        if ((feed.occupants & (1u << k)) && feed.overlays[k]) {
+            drawLayer(*feed.overlays[k]);
+        }
+    }
+    feed.target->display();
+
+    ++renderCount;
+    TSS_LOG_TRACE("CameraSystem", "Rendered feed", field("room", selected), field("occupants", feed.occupants));
+    return true;
+}
+
+void CameraSystem::submit(const sf::FloatRect& screenRect, RenderLayer layer) {
+    if (!monitorOpen) {
+        return;
+    }
+    const Feed& feed = feeds[index(selected)];
+    if (feed.target) {
+        sf::FloatRect textureRect(0.0f, 0.0f, static_cast<float>(feedSize.x), static_cast<float>(feedSize.y));
+        RenderQueue::getInstance().submitQuad(&feed.target->getTexture(), sf::Transform::Identity,
+                                              screenRect, textureRect, sf::Color::White, layer);
+    }
+    noise.submit(screenRect, RenderLayer::Overlay);
+}
+
+} // namespace Engine
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "../../animatronics/Animatronic.hpp"
+#include "../render/RenderQueue.hpp"
+#include "StaticNoise.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Engine {
+
+// Security camera monitor. Each feed (one per camera room) is composited -
+// room background, animatronic overlays and the room's lighting - into its
+// own sf::RenderTexture, which is kept between frames. A feed is redrawn
+// only after something in it changed and only while it is the one on
+// screen; feeds nobody looks at are never rendered and never allocate a
+// render texture. Showing a feed is then one textured quad.
+//
+// Static noise and the camera map change every frame and are drawn on top
+// of the cached feed, not baked into it.
+class CameraSystem {
+public:
+    static CameraSystem& getInstance();
+
+    bool addFeed(Room room, const std::string& backgroundPath);
+    // Flat `color` background, for rooms whose art is missing
+    bool addPlaceholderFeed(Room room, const sf::Color& color);
+    // Drawn over the background while `kind` is in the room
+    bool addOverlay(Room room, AnimatronicKind kind, const std::string& path);
+    bool hasFeed(Room room) const { return feeds[index(room)].background != nullptr; }
+
+    // Resolution of the cached feeds; drops every cached render
+    void setFeedSize(unsigned int width, unsigned int height);
+
+    void setMonitorOpen(bool open) { monitorOpen = open; }
+    bool isMonitorOpen() const { return monitorOpen; }
+    void selectFeed(Room room);
+    Room getSelectedFeed() const { return selected; }
+
+    // 0 = dark, 1 = fully lit
+    void setLightLevel(Room room, float level);
+
+    // Rebuilds room occupancy from the AI and dirties the feeds that changed
+    void updateOccupancy(const AgentData& agents);
+    void markDirty(Room room) { feeds[index(room)].dirty = true; }
+
+    // Static over the feed, 0-1
+    void setStaticIntensity(float intensity) { noise.setIntensity(intensity); }
+
+    // Re-renders the selected feed if it is dirty and advances the static;
+    // call once per frame
+    void render();
+
+    // Queues the selected feed stretched over `screenRect`, static on top.
+    // The static is queued even before the feed has rendered.
+    void submit(const sf::FloatRect& screenRect, RenderLayer layer = RenderLayer::Scene);
+
+    // Feed renders since startup, for profiling the cache
+    std::size_t getRenderCount() const { return renderCount; }
+
+    CameraSystem(const CameraSystem&) = delete;
+    CameraSystem& operator=(const CameraSystem&) = delete;
+
+private:
+    CameraSystem();
+
+    struct Feed {
+        std::unique_ptr<sf::Texture> background;
+        std::array<std::unique_ptr<sf::Texture>, ANIMATRONIC_KIND_COUNT> overlays;
+        std::unique_ptr<sf::RenderTexture> target;   // Created on first render
+        std::uint8_t occupants = 0;                  // Bit per AnimatronicKind
+        float lightLevel = 1.0f;
+        bool dirty = true;
+    };
+
+    static std::size_t index(Room room) { return static_cast<std::size_t>(room); }
+    bool renderFeed(Feed& feed);
+
+    std::array<Feed, ROOM_COUNT> feeds;
+    StaticNoise noise;
+    sf::Vector2u feedSize;
+    Room selected;
+    bool monitorOpen;
+    std::size_t renderCount;
+};
+
+} // namespace Engine
@@ -0,0 +1,139 @@
+#include "FlashlightSystem.hpp"
+#include "../ui/ScalingManager.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace Engine {
+
+namespace {
+    // Lights add up in the buffer: dst += src
+    const sf::BlendMode BLEND_ACCUMULATE(sf::BlendMode::One, sf::BlendMode::One, sf::BlendMode::Add);
+}
+
+FlashlightSystem::FlashlightSystem()
+    : bufferSize(0, 0)
+    , scalingEpoch(0)
+    , quads(sf::Triangles)
+    , flashlight{ sf::Vector2f(0.5f, 0.5f), 220.0f, sf::Color(255, 244, 214) }
+    , flashlightOn(false)
+    , ambient(12, 12, 18)
+{
+}
+
+FlashlightSystem& FlashlightSystem::getInstance() {
+    static FlashlightSystem instance;
+    return instance;
+}
+
+bool FlashlightSystem::createFalloff() {
+    // Smooth quadratic falloff to zero at the edge of the circle
+    std::vector<sf::Uint8> pixels(FALLOFF_SIZE * FALLOFF_SIZE * 4);
+    const float half = static_cast<float>(FALLOFF_SIZE) / 2.0f;
+    for (unsigned int y = 0; y < FALLOFF_SIZE; ++y) {
+        for (unsigned int x = 0; x < FALLOFF_SIZE; ++x) {
+            float dx = (static_cast<float>(x) + 0.5f - half) / half;
+            float dy = (static_cast<float>(y) + 0.5f - half) / half;
+            float t = std::max(0.0f, 1.0f - std::sqrt(dx * dx + dy * dy));
+            auto value = static_cast<sf::Uint8>(std::lround(255.0f * t * t * (3.0f - 2.0f * t)));
+            sf::Uint8* pixel = &pixels[(y * FALLOFF_SIZE + x) * 4];
+            pixel[0] = pixel[1] = pixel[2] = value;
+            pixel[3] = 255;
+        }
+    }
+
+    auto texture = std::make_unique<sf::Texture>();
+    if (!texture->create(FALLOFF_SIZE, FALLOFF_SIZE)) {
+        std::cerr << "FlashlightSystem: Failed to create falloff texture" << std::endl;
+        return false;
+    }
+    texture->update(pixels.data());
+    texture->setSmooth(true);
+    falloff = std::move(texture);
+    return true;
+}
+
+bool FlashlightSystem::resizeBuffer() {
+    auto& scaling = ScalingManager::getInstance();
+    sf::Vector2u window = scaling.getRenderSize();
+    sf::Vector2u size(std::max(1u, window.x / BUFFER_DIVISOR), std::max(1u, window.y / BUFFER_DIVISOR));
+    scalingEpoch = scaling.getEpoch();
+    if (buffer && size == bufferSize) {
+        return true;
+    }
+
+    auto target = std::make_unique<sf::RenderTexture>();
+    if (!target->create(size.x, size.y)) {
+        std::cerr << "FlashlightSystem: Failed to create " << size.x << "x" << size.y << " light buffer" << std::endl;
+        return false;
+    }
+    target->setSmooth(true);
+    buffer = std::move(target);
+    bufferSize = size;
+    TSS_LOG_DEBUG("FlashlightSystem", "Light buffer resized", field("width", size.x), field("height", size.y));
+    return true;
+}
+
+void FlashlightSystem::appendLight(const LightSource& light, float scale) {
+    sf::Vector2f center(light.position.x * static_cast<float>(bufferSize.x),
+                        light.position.y * static_cast<float>(bufferSize.y));
+    float radius = light.radius * scale;
+    float size = static_cast<float>(FALLOFF_SIZE);
+
+    sf::Vertex corners[4] = {
+        sf::Vertex(center + sf::Vector2f(-radius, -radius), light.color, sf::Vector2f(0.0f, 0.0f)),
+        sf::Vertex(center + sf::Vector2f(radius, -radius), light.color, sf::Vector2f(size, 0.0f)),
+        sf::Vertex(center + sf::Vector2f(radius, radius), light.color, sf::Vector2f(size, size)),
+        sf::Vertex(center + sf::Vector2f(-radius, radius), light.color, sf::Vector2f(0.0f, size))
+    };
+    quads.append(corners[0]);
+    quads.append(corners[1]);
+    quads.append(corners[2]);
+    quads.append(corners[0]);
+    quads.append(corners[2]);
+    quads.append(corners[3]);
+}
+
+bool FlashlightSystem::render() {
+    if (!falloff && !createFalloff()) {
+        return false;
+    }
+    if ((!buffer || scalingEpoch != ScalingManager::getInstance().getEpoch()) && !resizeBuffer()) {
+        return false;
+    }
+
+    // Radii are authored at 720p; the buffer is a fraction of the window
+    float scale = static_cast<float>(bufferSize.y) / static_cast<float>(ScalingManager::BASE_HEIGHT);
+
+    quads.clear();
+    if (flashlightOn) {
+        appendLight(flashlight, scale);
+    }
+    for (const auto& light : lights) {
+        appendLight(light, scale);
+    }
+
+    buffer->clear(ambient);
+    if (quads.getVertexCount() > 0) {
+        sf::RenderStates states(BLEND_ACCUMULATE);
+        states.texture = falloff.get();
+        buffer->draw(quads, states);
+    }
+    buffer->display();
+    return true;
+}
+
+void FlashlightSystem::submit(RenderLayer layer) {
+    if (!buffer) {
+        return;
+    }
+    sf::Vector2u window = ScalingManager::getInstance().getRenderSize();
+    sf::FloatRect screenRect(0.0f, 0.0f, static_cast<float>(window.x), static_cast<float>(window.y));
+    sf::FloatRect textureRect(0.0f, 0.0f, static_cast<float>(bufferSize.x), static_cast<float>(bufferSize.y));
+    RenderQueue::getInstance().submitQuad(&buffer->getTexture(), sf::Transform::Identity, screenRect, textureRect,
+                                          sf::Color::White, layer, nullptr, sf::BlendMultiply);
+}
+
+} // namespace Engine
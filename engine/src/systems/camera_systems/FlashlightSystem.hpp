@@ -0,0 +1,72 @@
+#pragma once
+
+#include "../render/RenderQueue.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+struct LightSource {
+    sf::Vector2f position;   // Normalized screen position (0-1)
+    float radius;            // In base-resolution (1280x720) pixels
+    sf::Color color;
+};
+
+// Office lighting. A radial falloff texture is generated once; every frame
+// each light is one quad of it added into a half-resolution light buffer
+// cleared to the ambient colour, and the buffer is stretched over the scene
+// with a multiplicative blend. The work per light is a quad at half
+// resolution, and the only full-screen pass is the final multiply.
+class FlashlightSystem {
+public:
+    static constexpr unsigned int FALLOFF_SIZE = 256;
+    static constexpr unsigned int BUFFER_DIVISOR = 2;
+
+    static FlashlightSystem& getInstance();
+
+    // Colour of unlit areas; black means only lights are visible
+    void setAmbient(const sf::Color& color) { ambient = color; }
+
+    // The flashlight follows the cursor while on
+    void setFlashlight(bool on) { flashlightOn = on; }
+    bool isFlashlightOn() const { return flashlightOn; }
+    void setFlashlightPosition(const sf::Vector2f& normalizedPosition) { flashlight.position = normalizedPosition; }
+    void setFlashlightRadius(float radius) { flashlight.radius = radius; }
+
+    // Extra lights for this frame (door lights, flickering bulbs)
+    void addLight(const LightSource& light) { lights.push_back(light); }
+    void clearLights() { lights.clear(); }
+
+    // Draws the lights into the light buffer; call once per frame
+    bool render();
+
+    // Queues the light buffer over the whole window
+    void submit(RenderLayer layer = RenderLayer::Overlay);
+
+    sf::Vector2u getBufferSize() const { return bufferSize; }
+
+    FlashlightSystem(const FlashlightSystem&) = delete;
+    FlashlightSystem& operator=(const FlashlightSystem&) = delete;
+
+private:
+    FlashlightSystem();
+
+    bool createFalloff();
+    bool resizeBuffer();
+    void appendLight(const LightSource& light, float scale);
+
+    std::unique_ptr<sf::Texture> falloff;
+    std::unique_ptr<sf::RenderTexture> buffer;
+    sf::Vector2u bufferSize;
+    std::uint64_t scalingEpoch;
+
+    sf::VertexArray quads;
+    std::vector<LightSource> lights;
+    LightSource flashlight;
+    bool flashlightOn;
+    sf::Color ambient;
+};
+
+} // namespace Engine
@@ -0,0 +1,194 @@
+#include "StaticNoise.hpp"
+#include "../render/TextureStreamer.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TSS_NOISE_SSE2 1
+#endif
+
+namespace Engine {
+
+namespace {
+    // Cell grid in `cells`, a fresh random offset per frame in `seed`
+    const char* NOISE_FRAGMENT_SHADER = R"(
+        #version 110
+        uniform vec2 cells;
+        uniform vec2 seed;
+
+        float hash(vec2 p) {
+            vec3 q = fract(vec3(p.xyx) * 0.1031);
+            q += dot(q, q.yzx + 33.33);
+            return fract((q.x + q.y) * q.z);
+        }
+
+        void main() {
+            vec2 cell = floor(gl_TexCoord[0].xy * cells);
+            float value = hash(cell + seed);
+            gl_FragColor = vec4(vec3(value), 1.0) * gl_Color;
+        }
+    )";
+
+    inline std::uint32_t xorshift(std::uint32_t& x) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+
+    // Grey level in the low byte of each 8-bit lane of `bits` -> opaque RGBA
+    inline std::uint32_t greyPixel(std::uint32_t bits) {
+        return (bits & 0xFFu) * 0x010101u | 0xFF000000u;
+    }
+}
+
+StaticNoise::StaticNoise()
+    : backend(NoiseBackend::Shader)
+    , backendChosen(false)
+    , cells(0, 0)
+    , tint(255, 255, 255, 255)
+    , shaderFailed(false)
+    , state{ 0x9E3779B9u, 0x7F4A7C15u, 0x85EBCA6Bu, 0xC2B2AE35u }
+{
+    setResolution(1280, 720);
+}
+
+void StaticNoise::chooseBackend() {
+    // Needs a GL context for the renderer check, so it runs on first update
+    backendChosen = true;
+    const char* mode = std::getenv("TSS_NOISE");
+    std::string requested = mode ? mode : "";
+    if (requested == "cpu") {
+        backend = NoiseBackend::Cpu;
+    } else if (requested == "shader") {
+        backend = NoiseBackend::Shader;
+    } else {
+        backend = TextureStreamer::getInstance().isSoftwareRenderer() ? NoiseBackend::Cpu : NoiseBackend::Shader;
+    }
+    TSS_LOG_INFO("StaticNoise", "Noise backend selected",
+                 field("backend", backend == NoiseBackend::Cpu ? "cpu" : "shader"));
+}
+
+void StaticNoise::setResolution(unsigned int width, unsigned int height, unsigned int divisor) {
+    divisor = std::max(1u, divisor);
+    sf::Vector2u count((width + divisor - 1) / divisor, (height + divisor - 1) / divisor);
+    if (count == cells) {
+        return;
+    }
+    cells = count;
+    texture.reset();
+    pixels.assign(static_cast<std::size_t>(cells.x) * cells.y, 0);
+}
+
+void StaticNoise::setIntensity(float intensity) {
+    tint.a = static_cast<sf::Uint8>(255.0f * std::clamp(intensity, 0.0f, 1.0f));
+}
+
+bool StaticNoise::prepareShader() {
+    if (shader) {
+        return true;
+    }
+    if (shaderFailed) {
+        return false;
+    }
+    auto program = std::make_unique<sf::Shader>();
+    if (!sf::Shader::isAvailable() || !program->loadFromMemory(NOISE_FRAGMENT_SHADER, sf::Shader::Fragment)) {
+        std::cerr << "StaticNoise: Noise shader unavailable, using the CPU path" << std::endl;
+        shaderFailed = true;
+        return false;
+    }
+    shader = std::move(program);
+    return true;
+}
+
+void StaticNoise::update() {
+    if (!backendChosen) {
+        chooseBackend();
+    }
+    if (backend == NoiseBackend::Shader && prepareShader()) {
+        // Large offsets keep consecutive frames uncorrelated
+        float x = static_cast<float>(xorshift(state[0]) & 0xFFFF);
+        float y = static_cast<float>(xorshift(state[1]) & 0xFFFF);
+        shader->setUniform("seed", sf::Glsl::Vec2(x, y));
+        shader->setUniform("cells", sf::Glsl::Vec2(static_cast<float>(cells.x), static_cast<float>(cells.y)));
+        return;
+    }
+    backend = NoiseBackend::Cpu;
+    updateCpu();
+}
+
+void StaticNoise::updateCpu() {
+    if (!texture) {
+        texture = std::make_unique<sf::Texture>();
+        if (!texture->create(cells.x, cells.y)) {
+            std::cerr << "StaticNoise: Failed to create " << cells.x << "x" << cells.y << " noise texture" << std::endl;
+            texture.reset();
+            return;
+        }
+        texture->setSmooth(false);
+        TSS_LOG_DEBUG("StaticNoise", "CPU noise texture", field("width", cells.x), field("height", cells.y));
+    }
+    fill(pixels.data(), pixels.size(), state);
+    TextureStreamer::getInstance().upload(*texture, reinterpret_cast<const sf::Uint8*>(pixels.data()), cells.x, cells.y);
+}
+
+void StaticNoise::submit(const sf::FloatRect& screenRect, RenderLayer layer) {
+    if (tint.a == 0) {
+        return;
+    }
+    auto& queue = RenderQueue::getInstance();
+    if (backend == NoiseBackend::Shader && shader) {
+        // No texture bound, so texture coordinates reach the shader as 0-1
+        queue.submitQuad(nullptr, sf::Transform::Identity, screenRect,
+                         sf::FloatRect(0.0f, 0.0f, 1.0f, 1.0f), tint, layer, shader.get());
+    } else if (texture) {
+        sf::FloatRect textureRect(0.0f, 0.0f, static_cast<float>(cells.x), static_cast<float>(cells.y));
+        queue.submitQuad(texture.get(), sf::Transform::Identity, screenRect, textureRect, tint, layer);
+    }
+}
+
+void StaticNoise::fill(std::uint32_t* pixels, std::size_t count, std::uint32_t (&state)[4]) {
+    std::size_t i = 0;
+
+#ifdef TSS_NOISE_SSE2
+    // Four xorshift32 generators side by side; each step yields 16 random
+    // bytes, which are widened to 16 grey pixels
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state));
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    for (; i + 16 <= count; i += 16) {
+        x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+        x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+        x = _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+
+        __m128i bytesLow = _mm_unpacklo_epi8(x, x);    // g0 g0 g1 g1 ... g7 g7
+        __m128i bytesHigh = _mm_unpackhi_epi8(x, x);   // g8 g8 ... g15 g15
+        __m128i out[4] = {
+            _mm_unpacklo_epi16(bytesLow, bytesLow),
+            _mm_unpackhi_epi16(bytesLow, bytesLow),
+            _mm_unpacklo_epi16(bytesHigh, bytesHigh),
+            _mm_unpackhi_epi16(bytesHigh, bytesHigh)
+        };
+        for (int j = 0; j < 4; ++j) {
+            __m128i pixel = _mm_or_si128(_mm_and_si128(out[j], rgbMask), alpha);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i + j * 4), pixel);
+        }
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), x);
+#endif
+
+    // Remainder (or everything without SSE2): one lane, four pixels per word
+    std::uint32_t& lane = state[0];
+    while (i < count) {
+        std::uint32_t bits = xorshift(lane);
+        for (int j = 0; j < 4 && i < count; ++j, ++i, bits >>= 8) {
+            pixels[i] = greyPixel(bits);
+        }
+    }
+}
+
+} // namespace Engine
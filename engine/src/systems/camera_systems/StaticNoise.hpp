@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../render/RenderQueue.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine {
+
+enum class NoiseBackend {
+    Shader,   // Hash per noise cell in a fragment shader, nothing uploaded
+    Cpu       // xorshift fill of a small texture, stretched with nearest filtering
+};
+
+// Animated monitor static, generated each frame instead of played back from
+// an image sequence. Noise is produced on a grid of cells `divisor` pixels
+// wide, which both backends share so they look alike.
+//
+// The backend defaults to the shader on GPUs and to the CPU path on software
+// rasterizers, where every fragment is paid for on the CPU anyway.
+// TSS_NOISE=shader|cpu overrides the choice.
+class StaticNoise {
+public:
+    static constexpr unsigned int DEFAULT_DIVISOR = 4;
+
+    StaticNoise();
+
+    void setBackend(NoiseBackend backend) { this->backend = backend; backendChosen = true; }
+    NoiseBackend getBackend() const { return backend; }
+
+    void setResolution(unsigned int width, unsigned int height, unsigned int divisor = DEFAULT_DIVISOR);
+    sf::Vector2u getCellCount() const { return cells; }
+
+    // 0 = invisible, 1 = opaque
+    void setIntensity(float intensity);
+
+    // Advances to the next frame of noise
+    void update();
+
+    void submit(const sf::FloatRect& screenRect, RenderLayer layer = RenderLayer::Overlay);
+
+    // Fills `count` opaque grey RGBA pixels from four xorshift32 lanes.
+    // Uses SSE2 when available (16 pixels per step), scalar otherwise.
+    static void fill(std::uint32_t* pixels, std::size_t count, std::uint32_t (&state)[4]);
+
+private:
+    void chooseBackend();
+    bool prepareShader();
+    void updateCpu();
+
+    NoiseBackend backend;
+    bool backendChosen;
+    sf::Vector2u cells;
+    sf::Color tint;
+
+    std::unique_ptr<sf::Shader> shader;
+    bool shaderFailed;
+
+    std::unique_ptr<sf::Texture> texture;
+    std::vector<std::uint32_t> pixels;
+    std::uint32_t state[4];
+};
+
+} // namespace Engine
@@ -0,0 +1,87 @@
+#include "BreakerSystem.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+
+namespace Engine {
+
+BreakerSystem::BreakerSystem(TimerWheel& timers)
+    : timers(timers)
+{
+    reset();
+}
+
+BreakerSystem::~BreakerSystem() {
+    timers.cancel(powerOutTimer);
+}
+
+void BreakerSystem::reset() {
+    devices.fill(false);
+    usage = 1;
+    level = FULL_POWER;
+    levelTime = now();
+    powerOut = false;
+    schedulePowerOut();
+}
+
+bool BreakerSystem::setDevice(PowerDevice device, bool on) {
+    if (powerOut) {
+        return false;
+    }
+    bool& state = devices[index(device)];
+    if (state == on) {
+        return true;
+    }
+    settle();
+    state = on;
+    usage += on ? 1 : -1;
+    schedulePowerOut();
+    return true;
+}
+
+void BreakerSystem::drain(float percent) {
+    if (powerOut) {
+        return;
+    }
+    settle();
+    level -= percent;
+    if (level <= 0.0f) {
+        timers.cancel(powerOutTimer);
+        cutPower(levelTime);
+        return;
+    }
+    schedulePowerOut();
+}
+
+float BreakerSystem::getPower() const {
+    if (powerOut) {
+        return 0.0f;
+    }
+    return std::max(0.0f, level - getDrainRate() * (now() - levelTime));
+}
+
+void BreakerSystem::settle() {
+    level = getPower();
+    levelTime = now();
+}
+
+void BreakerSystem::schedulePowerOut() {
+    timers.cancel(powerOutTimer);
+    powerOutTime = levelTime + level / getDrainRate();
+    float when = powerOutTime;
+    powerOutTimer = timers.schedule(powerOutTime - now(), [this, when] { cutPower(when); });
+}
+
+void BreakerSystem::cutPower(float time) {
+    level = 0.0f;
+    levelTime = time;
+    powerOutTime = time;
+    powerOut = true;
+    devices.fill(false);
+    usage = 1;
+    TSS_LOG_DEBUG("BreakerSystem", "Power out", field("time", time));
+    if (onPowerOut) {
+        onPowerOut(time);
+    }
+}
+
+} // namespace Engine
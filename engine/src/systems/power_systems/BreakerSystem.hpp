@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../../core/TimerWheel.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Engine {
+
+enum class PowerDevice : std::uint8_t {
+    LeftDoor,
+    RightDoor,
+    LeftLight,
+    RightLight,
+    Camera,
+    Count
+};
+
+constexpr std::size_t POWER_DEVICE_COUNT = static_cast<std::size_t>(PowerDevice::Count);
+
+// Office power. One usage bar is always on and every active device adds a
+// bar; each bar drains DRAIN_PER_BAR percent per second.
+//
+// The drain rate only changes when a device switches, so power is stored as
+// the level at the last change plus a constant rate, and everything else is
+// computed from that: the level at any time and the time it will hit zero.
+// The power-out is a timer on the night's TimerWheel, rescheduled whenever
+// the rate changes. Nothing runs per frame, and results do not depend on
+// the frame rate or the step size. Times are the wheel's clock.
+class BreakerSystem {
+public:
+    using PowerOutCallback = std::function<void(float time)>;
+
+    static constexpr float FULL_POWER = 100.0f;
+    static constexpr float DRAIN_PER_BAR = 1.0f / 9.6f;
+
+    explicit BreakerSystem(TimerWheel& timers);
+    ~BreakerSystem();
+
+    BreakerSystem(const BreakerSystem&) = delete;
+    BreakerSystem& operator=(const BreakerSystem&) = delete;
+
+    void reset();
+
+    // Returns false if the power is out
+    bool setDevice(PowerDevice device, bool on);
+    bool isOn(PowerDevice device) const { return devices[index(device)]; }
+
+    int getUsage() const { return usage; }
+    float getDrainRate() const { return static_cast<float>(usage) * DRAIN_PER_BAR; }
+
+    // One-off cost, e.g. Foxy banging on the door
+    void drain(float percent);
+
+    float getPower() const;
+    // When the power runs out at the current rate
+    float getPowerOutTime() const { return powerOutTime; }
+    bool isPowerOut() const { return powerOut; }
+
+    void setPowerOutCallback(PowerOutCallback callback) { onPowerOut = std::move(callback); }
+
+private:
+    static std::size_t index(PowerDevice device) { return static_cast<std::size_t>(device); }
+
+    float now() const { return static_cast<float>(timers.getTime()); }
+
+    // Folds the drain since the last change into `level`
+    void settle();
+    void schedulePowerOut();
+    void cutPower(float time);
+
+    TimerWheel& timers;
+    TimerHandle powerOutTimer;
+
+    std::array<bool, POWER_DEVICE_COUNT> devices;
+    int usage;
+    float level;          // Power at `levelTime`
+    float levelTime;
+    float powerOutTime;
+    bool powerOut;
+    PowerOutCallback onPowerOut;
+};
+
+} // namespace Engine
@@ -0,0 +1,145 @@
+#include "RenderQueue.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace Engine {
+
+RenderQueue::RenderQueue()
+    : vertices(sf::Triangles)
+    , clearColor(sf::Color::Black)
+    , lastBatchCount(0)
+    , lastQuadCount(0)
+    , presentedValid(false)
+{
+}
+
+RenderQueue& RenderQueue::getInstance() {
+    static RenderQueue instance;
+    return instance;
+}
+
+void RenderQueue::submit(const sf::Sprite& sprite, RenderLayer layer, const sf::Shader* shader,
+                         const sf::BlendMode& blendMode) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    sf::FloatRect textureRect(sprite.getTextureRect());
+    sf::FloatRect localRect(0.f, 0.f, std::abs(textureRect.width), std::abs(textureRect.height));
+    submitQuad(texture, sprite.getTransform(), localRect, textureRect, sprite.getColor(), layer, shader, blendMode);
+}
+
+void RenderQueue::submitQuad(const sf::Texture* texture, const sf::Transform& transform,
+                             const sf::FloatRect& localRect, const sf::FloatRect& textureRect,
+                             const sf::Color& color, RenderLayer layer, const sf::Shader* shader,
+                             const sf::BlendMode& blendMode) {
+    Quad quad;
+    quad.texture = texture;
+    quad.shader = shader;
+    quad.blendMode = blendMode;
+    quad.layer = layer;
+    quad.order = quads.size();
+
+    const float left = localRect.left;
+    const float top = localRect.top;
+    const float right = localRect.left + localRect.width;
+    const float bottom = localRect.top + localRect.height;
+
+    const float u0 = textureRect.left;
+    const float v0 = textureRect.top;
+    const float u1 = textureRect.left + textureRect.width;
+    const float v1 = textureRect.top + textureRect.height;
+
+    quad.vertices[0] = sf::Vertex(transform.transformPoint(left, top), color, sf::Vector2f(u0, v0));
+    quad.vertices[1] = sf::Vertex(transform.transformPoint(right, top), color, sf::Vector2f(u1, v0));
+    quad.vertices[2] = sf::Vertex(transform.transformPoint(right, bottom), color, sf::Vector2f(u1, v1));
+    quad.vertices[3] = sf::Vertex(transform.transformPoint(left, bottom), color, sf::Vector2f(u0, v1));
+
+    quads.push_back(quad);
+}
+
+void RenderQueue::submitRect(const sf::FloatRect& rect, const sf::Color& color, RenderLayer layer) {
+    submitQuad(nullptr, sf::Transform::Identity, rect, sf::FloatRect(), color, layer);
+}
+
+bool RenderQueue::sameQuad(const Quad& a, const Quad& b) {
+    if (a.texture != b.texture || a.shader != b.shader || a.blendMode != b.blendMode || a.layer != b.layer) {
+        return false;
+    }
+    for (int i = 0; i < 4; ++i) {
+        const sf::Vertex& va = a.vertices[i];
+        const sf::Vertex& vb = b.vertices[i];
+        if (va.position != vb.position || va.color != vb.color || va.texCoords != vb.texCoords) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RenderQueue::isUnchanged() const {
+    return presentedValid && clearColor == presentedClearColor &&
+           std::equal(quads.begin(), quads.end(), presentedQuads.begin(), presentedQuads.end(), sameQuad);
+}
+
+void RenderQueue::discard() {
+    quads.clear();
+    clearColor = sf::Color::Black;
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    target.clear(clearColor);
+    presentedClearColor = clearColor;
+    presentedQuads = quads;
+    presentedValid = true;
+    clearColor = sf::Color::Black;
+
+    lastQuadCount = quads.size();
+    lastBatchCount = 0;
+    if (quads.empty()) {
+        return;
+    }
+
+    std::sort(quads.begin(), quads.end(), [](const Quad& a, const Quad& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.shader != b.shader) return std::less<const sf::Shader*>()(a.shader, b.shader);
+        if (a.texture != b.texture) return std::less<const sf::Texture*>()(a.texture, b.texture);
+        return a.order < b.order;
+    });
+
+    // Two triangles per quad, all batches share one vertex array
+    vertices.resize(quads.size() * 6);
+    for (std::size_t i = 0; i < quads.size(); ++i) {
+        const sf::Vertex* corners = quads[i].vertices;
+        sf::Vertex* out = &vertices[i * 6];
+        out[0] = corners[0];
+        out[1] = corners[1];
+        out[2] = corners[2];
+        out[3] = corners[0];
+        out[4] = corners[2];
+        out[5] = corners[3];
+    }
+
+    // One draw call per run of quads sharing layer, shader, texture and blend mode
+    std::size_t batchStart = 0;
+    for (std::size_t i = 1; i <= quads.size(); ++i) {
+        if (i < quads.size() &&
+            quads[i].layer == quads[batchStart].layer &&
+            quads[i].shader == quads[batchStart].shader &&
+            quads[i].texture == quads[batchStart].texture &&
+            quads[i].blendMode == quads[batchStart].blendMode) {
+            continue;
+        }
+
+        sf::RenderStates states;
+        states.texture = quads[batchStart].texture;
+        states.shader = quads[batchStart].shader;
+        states.blendMode = quads[batchStart].blendMode;
+        target.draw(&vertices[batchStart * 6], (i - batchStart) * 6, sf::Triangles, states);
+        ++lastBatchCount;
+        batchStart = i;
+    }
+
+    quads.clear();
+}
+
+} // namespace Engine
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+
+// Draw order between groups of quads. Within a layer, quads are grouped by
+// texture, so overlapping quads that must stack in a fixed order belong on
+// different layers.
+enum class RenderLayer : int {
+    Background = 0,   // Full-screen video/backdrops
+    Scene = 100,      // Office, camera feeds
+    Overlay = 200,    // Animatronic overlays, effects
+    UI = 300,         // Menu text, buttons, selector
+    UIOverlay = 350,  // Marks drawn over UI elements (option checks)
+    Debug = 400       // Hitbox visualisation
+};
+
+// Collects textured quads during a state's draw() and submits them as a
+// few sf::VertexArray batches, sorted by layer, shader, then texture.
+// Shaders are drawn with the uniforms they hold at flush time. Quads with a
+// blend mode other than alpha start their own batch.
+//
+// The quads of the last flushed frame are kept, so a frame that submits
+// exactly the same quads can be recognised and skipped. That only holds
+// while the textures' contents and shader uniforms don't change on their
+// own (see GameState::isStatic); invalidate() forces the next frame out.
+class RenderQueue {
+public:
+    static RenderQueue& getInstance();
+
+    // Colour the target is cleared to on the next flush
+    void setClearColor(const sf::Color& color) { clearColor = color; }
+
+    void submit(const sf::Sprite& sprite, RenderLayer layer, const sf::Shader* shader = nullptr,
+                const sf::BlendMode& blendMode = sf::BlendAlpha);
+    void submitQuad(const sf::Texture* texture, const sf::Transform& transform,
+                    const sf::FloatRect& localRect, const sf::FloatRect& textureRect,
+                    const sf::Color& color, RenderLayer layer, const sf::Shader* shader = nullptr,
+                    const sf::BlendMode& blendMode = sf::BlendAlpha);
+    void submitRect(const sf::FloatRect& rect, const sf::Color& color, RenderLayer layer);
+
+    // Clears the target, draws everything submitted this frame and resets
+    void flush(sf::RenderTarget& target);
+
+    // True when this frame's submissions and clear colour match the last
+    // flushed frame
+    bool isUnchanged() const;
+    // Drops this frame's submissions without drawing (the target keeps the
+    // last flushed frame)
+    void discard();
+    // The target no longer holds the last flushed frame (resize, new state)
+    void invalidate() { presentedValid = false; }
+
+    std::size_t getLastBatchCount() const { return lastBatchCount; }
+    std::size_t getLastQuadCount() const { return lastQuadCount; }
+
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+private:
+    RenderQueue();
+
+    struct Quad {
+        const sf::Texture* texture;
+        const sf::Shader* shader;
+        sf::BlendMode blendMode;
+        RenderLayer layer;
+        std::size_t order;        // Submission index, keeps sorting stable
+        sf::Vertex vertices[4];   // Transformed corners: TL, TR, BR, BL
+    };
+
+    static bool sameQuad(const Quad& a, const Quad& b);
+
+    std::vector<Quad> quads;
+    sf::VertexArray vertices;
+    sf::Color clearColor;
+    std::size_t lastBatchCount;
+    std::size_t lastQuadCount;
+    std::vector<Quad> presentedQuads;     // Last flushed frame, in submission order
+    sf::Color presentedClearColor;
+    bool presentedValid;
+};
+
+} // namespace Engine
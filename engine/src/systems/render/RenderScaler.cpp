@@ -0,0 +1,101 @@
+#include "RenderScaler.hpp"
+#include "../ui/ScalingManager.hpp"
+#include "../../core/Logger.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace Engine {
+
+RenderScaler& RenderScaler::getInstance() {
+    static RenderScaler instance;
+    return instance;
+}
+
+RenderScaler::RenderScaler()
+    : dynamic(true)
+    , scale(MAX_SCALE)
+    , averageLoad(0.0f)
+    , framesSinceChange(0)
+    , offscreen(false)
+    , targetSize(0, 0)
+{
+}
+
+void RenderScaler::setFixedScale(float fixed) {
+    dynamic = fixed <= 0.0f;
+    averageLoad = 0.0f;
+    framesSinceChange = 0;
+    applyScale(dynamic ? MAX_SCALE : fixed);
+}
+
+void RenderScaler::applyScale(float newScale) {
+    scale = std::min(std::max(newScale, MIN_SCALE), MAX_SCALE);
+    ScalingManager::getInstance().setRenderScale(scale);
+}
+
+sf::RenderTarget& RenderScaler::beginFrame(sf::RenderWindow& window) {
+    offscreen = false;
+    if (scale >= MAX_SCALE) {
+        target.reset();
+        return window;
+    }
+
+    sf::Vector2u size = ScalingManager::getInstance().getRenderSize();
+    if (!target || size != targetSize) {
+        auto texture = std::make_unique<sf::RenderTexture>();
+        if (!texture->create(size.x, size.y)) {
+            std::cerr << "RenderScaler: Failed to create " << size.x << "x" << size.y
+                      << " render target, drawing at full size" << std::endl;
+            applyScale(MAX_SCALE);
+            target.reset();
+            return window;
+        }
+        texture->setSmooth(true);
+        target = std::move(texture);
+        targetSize = size;
+        TSS_LOG_DEBUG("RenderScaler", "Render target resized", field("width", size.x),
+                      field("height", size.y), field("scale", scale));
+    }
+
+    offscreen = true;
+    return *target;
+}
+
+void RenderScaler::present(sf::RenderWindow& window) {
+    if (!offscreen) {
+        return;
+    }
+    target->display();
+
+    sf::Sprite frame(target->getTexture());
+    sf::Vector2u windowSize = window.getSize();
+    frame.setScale(static_cast<float>(windowSize.x) / targetSize.x,
+                   static_cast<float>(windowSize.y) / targetSize.y);
+    window.draw(frame, sf::BlendNone);
+}
+
+void RenderScaler::recordFrameTime(float workSeconds, float budgetSeconds) {
+    if (!dynamic || budgetSeconds <= 0.0f) {
+        return;
+    }
+
+    averageLoad += (workSeconds / budgetSeconds - averageLoad) * SMOOTHING;
+    if (++framesSinceChange < SETTLE_FRAMES) {
+        return;
+    }
+
+    float newScale = scale;
+    if (averageLoad > HIGH_LOAD && scale > MIN_SCALE) {
+        newScale = scale - SCALE_STEP;
+    } else if (averageLoad < LOW_LOAD && scale < MAX_SCALE) {
+        newScale = scale + SCALE_STEP;
+    }
+    if (newScale != scale) {
+        TSS_LOG_DEBUG("RenderScaler", "Render scale changed", field("load", averageLoad),
+                      field("scale", newScale));
+        applyScale(newScale);
+        framesSinceChange = 0;
+    }
+}
+
+} // namespace Engine
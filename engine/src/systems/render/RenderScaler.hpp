@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+
+namespace Engine {
+
+// Renders each frame into an offscreen target at a fraction of the window
+// size and stretches it onto the window with one blit. Below 100% the
+// fill-rate cost of the frame (animation sprites, the light buffer, static
+// noise) drops with the square of the scale.
+//
+// In dynamic mode the scale follows the measured frame work: when the
+// smoothed work time nears the frame budget the scale steps down, and when
+// it is well under budget it steps back up. ScalingManager lays out in the
+// render target's pixels and maps mouse positions from window pixels, so
+// hitboxes match what is drawn at any scale.
+class RenderScaler {
+public:
+    static RenderScaler& getInstance();
+
+    // 0 selects dynamic scaling; anything else is a fixed scale
+    void setFixedScale(float scale);
+    bool isDynamic() const { return dynamic; }
+    float getScale() const { return scale; }
+
+    // Target to draw this frame into: the window itself at 100%
+    sf::RenderTarget& beginFrame(sf::RenderWindow& window);
+
+    // Upscales the frame onto the window (nothing to do at 100%)
+    void present(sf::RenderWindow& window);
+
+    // Time spent producing the last frame (excluding the frame limiter's
+    // sleep), against the time one frame may take
+    void recordFrameTime(float workSeconds, float budgetSeconds);
+
+    static constexpr float MIN_SCALE = 0.5f;
+    static constexpr float MAX_SCALE = 1.0f;
+    static constexpr float SCALE_STEP = 0.125f;
+
+    RenderScaler(const RenderScaler&) = delete;
+    RenderScaler& operator=(const RenderScaler&) = delete;
+
+private:
+    RenderScaler();
+
+    void applyScale(float newScale);
+
+    static constexpr float SMOOTHING = 0.1f;          // Weight of the newest frame
+    static constexpr float HIGH_LOAD = 0.85f;         // Of the budget: step down
+    static constexpr float LOW_LOAD = 0.5f;           // Of the budget: step up
+    static constexpr int SETTLE_FRAMES = 30;          // Between changes
+
+    bool dynamic;
+    float scale;
+    float averageLoad;        // Smoothed work time / budget
+    int framesSinceChange;
+    bool offscreen;           // This frame went into the target
+
+    std::unique_ptr<sf::RenderTexture> target;
+    sf::Vector2u targetSize;
+};
+
+} // namespace Engine
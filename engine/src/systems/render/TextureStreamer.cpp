@@ -0,0 +1,212 @@
+#include "TextureStreamer.hpp"
+#include "../../core/Logger.hpp"
+#include <SFML/OpenGL.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+#ifndef GL_WRITE_ONLY
+#define GL_WRITE_ONLY 0x88B9
+#endif
+
+namespace Engine {
+
+// Buffer object entry points are not exported by libGL on every platform,
+// so they are resolved through SFML's context at runtime
+struct TextureStreamer::GlFunctions {
+    void (APIENTRY *genBuffers)(GLsizei, GLuint*) = nullptr;
+    void (APIENTRY *deleteBuffers)(GLsizei, const GLuint*) = nullptr;
+    void (APIENTRY *bindBuffer)(GLenum, GLuint) = nullptr;
+    void (APIENTRY *bufferData)(GLenum, std::ptrdiff_t, const void*, GLenum) = nullptr;
+    void* (APIENTRY *mapBuffer)(GLenum, GLenum) = nullptr;
+    GLboolean (APIENTRY *unmapBuffer)(GLenum) = nullptr;
+
+    template <typename T>
+    static void load(T& function, const char* name) {
+        function = reinterpret_cast<T>(sf::Context::getFunction(name));
+    }
+
+    bool loadAll() {
+        load(genBuffers, "glGenBuffers");
+        load(deleteBuffers, "glDeleteBuffers");
+        load(bindBuffer, "glBindBuffer");
+        load(bufferData, "glBufferData");
+        load(mapBuffer, "glMapBuffer");
+        load(unmapBuffer, "glUnmapBuffer");
+        return genBuffers && deleteBuffers && bindBuffer && bufferData && mapBuffer && unmapBuffer;
+    }
+};
+
+TextureStreamer::TextureStreamer()
+    : initialized(false)
+    , usePixelBuffers(false)
+    , softwareRenderer(false)
+    , gl(std::make_unique<GlFunctions>())
+    , pixelBuffers{0, 0}
+    , nextBuffer(0)
+    , pool(std::make_shared<Pool>())
+{
+}
+
+// Pixel buffers are released together with the GL context at exit
+TextureStreamer::~TextureStreamer() = default;
+
+TextureStreamer& TextureStreamer::getInstance() {
+    static TextureStreamer instance;
+    return instance;
+}
+
+void TextureStreamer::initialize() {
+    initialized = true;
+
+    const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    std::string rendererName = renderer ? renderer : "unknown";
+    softwareRenderer = rendererName.find("llvmpipe") != std::string::npos ||
+                       rendererName.find("softpipe") != std::string::npos ||
+                       rendererName.find("Software Rasterizer") != std::string::npos;
+
+    const char* mode = std::getenv("TSS_TEXTURE_STREAMING");
+    std::string requested = mode ? mode : "";
+
+    bool wantPixelBuffers = requested == "pbo" || (requested != "direct" && !softwareRenderer);
+    bool supported = sf::Context::isExtensionAvailable("GL_ARB_pixel_buffer_object") && gl->loadAll();
+
+    usePixelBuffers = wantPixelBuffers && supported;
+    if (usePixelBuffers) {
+        gl->genBuffers(2, pixelBuffers);
+        usePixelBuffers = pixelBuffers[0] != 0 && pixelBuffers[1] != 0;
+    }
+
+    TSS_LOG_INFO("TextureStreamer", "Upload path selected",
+                 field("renderer", rendererName),
+                 field("mode", usePixelBuffers ? "pbo" : "direct"));
+}
+
+bool TextureStreamer::isUsingPixelBuffers() {
+    if (!initialized) {
+        initialize();
+    }
+    return usePixelBuffers;
+}
+
+bool TextureStreamer::isSoftwareRenderer() {
+    if (!initialized) {
+        initialize();
+    }
+    return softwareRenderer;
+}
+
+void TextureStreamer::setMaxPooledTextures(std::size_t max) {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->maxFree = max;
+    if (pool->freeTextures.size() > max) {
+        pool->freeTextures.resize(max);
+    }
+}
+
+std::size_t TextureStreamer::getMaxPooledTextures() const {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    return pool->maxFree;
+}
+
+std::shared_ptr<sf::Texture> TextureStreamer::acquire(unsigned int width, unsigned int height) {
+    std::unique_ptr<sf::Texture> texture;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto& freeTextures = pool->freeTextures;
+        for (auto it = freeTextures.begin(); it != freeTextures.end(); ++it) {
+            auto size = (*it)->getSize();
+            if (size.x == width && size.y == height) {
+                texture = std::move(*it);
+                freeTextures.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (!texture) {
+        texture = std::make_unique<sf::Texture>();
+        if (!texture->create(width, height)) {
+            std::cerr << "TextureStreamer: Failed to create " << width << "x" << height << " texture" << std::endl;
+            return nullptr;
+        }
+    }
+
+    // Released textures return to the ring; the pool may already be gone at exit
+    std::weak_ptr<Pool> weakPool = pool;
+    return std::shared_ptr<sf::Texture>(texture.release(), [weakPool](sf::Texture* released) {
+        if (auto owner = weakPool.lock()) {
+            std::lock_guard<std::mutex> lock(owner->mutex);
+            if (owner->freeTextures.size() < owner->maxFree) {
+                owner->freeTextures.emplace_back(released);
+                return;
+            }
+        }
+        delete released;
+    });
+}
+
+bool TextureStreamer::upload(sf::Texture& texture, const sf::Uint8* pixels, unsigned int width, unsigned int height) {
+    if (!pixels || texture.getSize() != sf::Vector2u(width, height)) {
+        std::cerr << "TextureStreamer::upload: Size mismatch or missing pixels" << std::endl;
+        return false;
+    }
+
+    if (!initialized) {
+        initialize();
+    }
+
+    if (usePixelBuffers && uploadWithPixelBuffer(texture, pixels, width, height)) {
+        return true;
+    }
+
+    texture.update(pixels);
+    return true;
+}
+
+bool TextureStreamer::uploadWithPixelBuffer(sf::Texture& texture, const sf::Uint8* pixels, unsigned int width, unsigned int height) {
+    const std::size_t byteCount = static_cast<std::size_t>(width) * height * 4;
+    const int index = nextBuffer;
+    nextBuffer ^= 1;
+
+    gl->bindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffers[index]);
+
+    // Orphan the previous storage so mapping never waits for an in-flight transfer
+    gl->bufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<std::ptrdiff_t>(byteCount), nullptr, GL_STREAM_DRAW);
+
+    void* mapped = gl->mapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+    if (!mapped) {
+        gl->bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        std::cerr << "TextureStreamer: Failed to map pixel buffer, disabling PBO uploads" << std::endl;
+        usePixelBuffers = false;
+        return false;
+    }
+    std::memcpy(mapped, pixels, byteCount);
+    gl->unmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    // Restore the previous binding afterwards so SFML's texture cache stays valid
+    GLint previousTexture = 0;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+
+    // Source pointer is an offset into the bound PBO; the copy runs asynchronously
+    glBindTexture(GL_TEXTURE_2D, texture.getNativeHandle());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                    GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previousTexture));
+
+    // SFML's own texture uploads must not source from our buffer
+    gl->bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return true;
+}
+
+} // namespace Engine
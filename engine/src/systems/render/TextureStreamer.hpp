@@ -0,0 +1,67 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Engine {
+
+// Streams decoded RGBA frames into reusable textures.
+//
+// Uploads go through two pixel buffer objects used alternately: the CPU
+// copies frame N+1 into one buffer while the driver is still transferring
+// frame N out of the other, so glTexSubImage2D never blocks on the copy.
+// Textures come from a ring of released textures of the same size instead
+// of being reallocated with glTexImage2D for every frame.
+//
+// On software rasterizers (llvmpipe/softpipe) PBOs only add a copy, so the
+// streamer falls back to sf::Texture::update. TSS_TEXTURE_STREAMING=pbo or
+// =direct overrides the detection (e.g. to exercise the PBO path on CI).
+class TextureStreamer {
+public:
+    static TextureStreamer& getInstance();
+
+    // Returns a texture of the given size. When the last reference is
+    // dropped the texture goes back to the ring for the next acquire.
+    std::shared_ptr<sf::Texture> acquire(unsigned int width, unsigned int height);
+
+    // Uploads tightly packed RGBA8 pixels into the whole texture
+    bool upload(sf::Texture& texture, const sf::Uint8* pixels, unsigned int width, unsigned int height);
+
+    bool isUsingPixelBuffers();
+    // llvmpipe/softpipe: fill-rate bound, favour CPU work over fragment work
+    bool isSoftwareRenderer();
+    void setMaxPooledTextures(std::size_t max);
+    std::size_t getMaxPooledTextures() const;
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+private:
+    TextureStreamer();
+    ~TextureStreamer();
+
+    struct GlFunctions;
+
+    struct Pool {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<sf::Texture>> freeTextures;
+        std::size_t maxFree = 8;
+    };
+
+    void initialize();
+    bool uploadWithPixelBuffer(sf::Texture& texture, const sf::Uint8* pixels, unsigned int width, unsigned int height);
+
+    bool initialized;
+    bool usePixelBuffers;
+    bool softwareRenderer;
+    std::unique_ptr<GlFunctions> gl;
+    unsigned int pixelBuffers[2];
+    int nextBuffer;
+
+    std::shared_ptr<Pool> pool;
+};
+
+} // namespace Engine
@@ -0,0 +1,113 @@
+#include "NightSession.hpp"
+#include "../../core/Logger.hpp"
+
+namespace Engine {
+
+namespace {
+    // Foxy's first bang costs 1%, each later one 5% more
+    constexpr float FOXY_BANG_COST = 1.0f;
+    constexpr float FOXY_BANG_GROWTH = 5.0f;
+
+    // Freddy shows up somewhere in this window after the power goes out
+    constexpr float POWER_OUT_GRACE_MIN = 5.0f;
+    constexpr float POWER_OUT_GRACE_RANGE = 15.0f;
+}
+
+NightSession::NightSession(const NightSettings& settings)
+    : settings(settings)
+    , ai(settings.seed)
+    , breaker(timers)
+    , watchedRoom(Room::ShowStage)
+    , outcome(NightOutcome::Running)
+    , killer(AnimatronicKind::Count)
+    , accumulator(0.0f)
+    , powerOutTime(-1.0f)
+    , foxyBangs(0)
+    , doorBlocks(0)
+    , rng(settings.seed * 2654435761U + 1U)
+{
+    for (std::size_t k = 0; k < ANIMATRONIC_KIND_COUNT; ++k) {
+        ai.spawn(static_cast<AnimatronicKind>(k), settings.aiLevels[k]);
+    }
+
+    breaker.setPowerOutCallback([this](float when) {
+        powerOutTime = when;
+        float grace = POWER_OUT_GRACE_MIN + POWER_OUT_GRACE_RANGE *
+            static_cast<float>(nextRandom(rng, 1000)) / 1000.0f;
+        freddyTimer = timers.schedule(grace, [this] {
+            if (outcome == NightOutcome::Running) {
+                kill(AnimatronicKind::Freddy);
+            }
+        });
+        TSS_LOG_DEBUG("NightSession", "Power out", field("time", when));
+    });
+}
+
+void NightSession::update(float deltaTime) {
+    accumulator += deltaTime;
+    while (accumulator >= AIManager::FIXED_STEP && outcome == NightOutcome::Running) {
+        step();
+        accumulator -= AIManager::FIXED_STEP;
+    }
+}
+
+void NightSession::step() {
+    if (outcome != NightOutcome::Running) {
+        return;
+    }
+
+    // Power-out and Freddy's visit fire from here
+    timers.advance(AIManager::FIXED_STEP);
+    if (outcome != NightOutcome::Running) {
+        return;
+    }
+
+    AIWorldState world;
+    world.leftDoorClosed = breaker.isOn(PowerDevice::LeftDoor);
+    world.rightDoorClosed = breaker.isOn(PowerDevice::RightDoor);
+    world.cameraUp = breaker.isOn(PowerDevice::Camera);
+    world.watchedRoom = world.cameraUp ? watchedRoom : Room::Count;
+    ai.setWorldState(world);
+    ai.tick();
+    handleEvents();
+
+    if (outcome != NightOutcome::Running) {
+        return;
+    }
+    if (getTime() >= settings.nightLength) {
+        outcome = NightOutcome::Survived;
+    }
+}
+
+void NightSession::handleEvents() {
+    for (const AIEvent& event : ai.getEvents()) {
+        if (event.type == AIEventType::Attack) {
+            kill(event.kind);
+            break;
+        }
+        if (event.type == AIEventType::Blocked) {
+            ++doorBlocks;
+            if (event.kind == AnimatronicKind::Foxy) {
+                breaker.drain(FOXY_BANG_COST + FOXY_BANG_GROWTH * static_cast<float>(foxyBangs));
+                ++foxyBangs;
+            }
+        }
+    }
+    ai.clearEvents();
+}
+
+void NightSession::kill(AnimatronicKind kind) {
+    outcome = NightOutcome::Killed;
+    killer = kind;
+}
+
+bool NightSession::isOccupied(Room room) const {
+    for (Room agentRoom : ai.getAgents().room) {
+        if (agentRoom == room) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace Engine
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../AIManager.hpp"
+#include "../../core/TimerWheel.hpp"
+#include "../power_systems/BreakerSystem.hpp"
+#include <array>
+#include <cstdint>
+
+namespace Engine {
+
+struct NightSettings {
+    std::array<int, ANIMATRONIC_KIND_COUNT> aiLevels{};   // Indexed by AnimatronicKind
+    float nightLength = 535.0f;                           // 12 AM to 6 AM in seconds
+    std::uint32_t seed = 1;
+};
+
+enum class NightOutcome : std::uint8_t {
+    Running,
+    Survived,
+    Killed
+};
+
+// One night of gameplay rules without any rendering: the AI, office power
+// and the clock, advanced in AIManager's fixed steps. Doors, lights and the
+// monitor are switched through the breaker, so whatever drives the session
+// (the player or a simulated policy) goes through the same power rules.
+// Night events run on the session's own TimerWheel, so sessions can run
+// side by side.
+class NightSession {
+public:
+    explicit NightSession(const NightSettings& settings);
+
+    // The breaker's power-out callback points back at the session
+    NightSession(const NightSession&) = delete;
+    NightSession& operator=(const NightSession&) = delete;
+
+    void update(float deltaTime);
+    void step();
+
+    // Returns false when the power is out
+    bool setDevice(PowerDevice device, bool on) { return breaker.setDevice(device, on); }
+    // Feed selected on the monitor; the AI only sees it while the camera is up
+    void setWatchedRoom(Room room) { watchedRoom = room; }
+    Room getWatchedRoom() const { return watchedRoom; }
+
+    // Lets large crowds tick across the pool (see AIManager)
+    void setJobSystem(JobSystem* jobs) { ai.setJobSystem(jobs); }
+
+    // Linear scan; a real night only has a handful of agents
+    bool isOccupied(Room room) const;
+
+    NightOutcome getOutcome() const { return outcome; }
+    float getTime() const { return static_cast<float>(timers.getTime()); }
+    float getNightLength() const { return settings.nightLength; }
+    AnimatronicKind getKiller() const { return killer; }
+    std::uint32_t getDoorBlocks() const { return doorBlocks; }
+    bool hadPowerOut() const { return powerOutTime >= 0.0f; }
+    float getPower() const { return breaker.getPower(); }
+
+    const BreakerSystem& getBreaker() const { return breaker; }
+    const AIManager& getAI() const { return ai; }
+
+private:
+    void handleEvents();
+    void kill(AnimatronicKind kind);
+
+    NightSettings settings;
+    TimerWheel timers;
+    AIManager ai;
+    BreakerSystem breaker;
+    Room watchedRoom;             // Starts on the monitor's first feed
+
+    NightOutcome outcome;
+    AnimatronicKind killer;
+    float accumulator;
+    float powerOutTime;       // -1 while the power is on
+    TimerHandle freddyTimer;  // Freddy's visit after the power goes out
+    std::uint32_t foxyBangs;
+    std::uint32_t doorBlocks;
+    std::uint32_t rng;
+};
+
+} // namespace Engine
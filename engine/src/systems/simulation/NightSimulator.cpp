@@ -0,0 +1,223 @@
+#include "NightSimulator.hpp"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <ostream>
+#include <thread>
+
+namespace Engine {
+
+namespace {
+    // Monitor checks cycle through the rooms that matter for the doors
+    constexpr Room CAMERA_ROUTE[] = { Room::PirateCove, Room::WestHall, Room::EastHallCorner, Room::ShowStage };
+    constexpr std::size_t CAMERA_ROUTE_LENGTH = sizeof(CAMERA_ROUTE) / sizeof(CAMERA_ROUTE[0]);
+
+    // Drives one session with the policy until the night ends
+    class PolicyDriver {
+    public:
+        PolicyDriver(NightSession& session, const CameraPolicy& policy)
+            : session(session), policy(policy) {}
+
+        void step() {
+            float time = session.getTime();
+
+            // Monitor
+            if (cameraUp && time >= cameraDownAt) {
+                cameraUp = false;
+                session.setDevice(PowerDevice::Camera, false);
+            } else if (!cameraUp && time >= nextCamera) {
+                cameraUp = session.setDevice(PowerDevice::Camera, true);
+                session.setWatchedRoom(CAMERA_ROUTE[cameraIndex++ % CAMERA_ROUTE_LENGTH]);
+                cameraDownAt = time + policy.cameraDuration;
+                nextCamera = time + policy.cameraInterval;
+            }
+            if (cameraUp && session.isOccupied(Room::WestHall)) {
+                closeDoor(leftDoor, time);   // Foxy is running
+            }
+
+            // Door lights
+            if (lightsOn && time >= lightsOffAt) {
+                lightsOn = false;
+                session.setDevice(PowerDevice::LeftLight, false);
+                session.setDevice(PowerDevice::RightLight, false);
+            } else if (!lightsOn && !cameraUp && time >= nextLight) {
+                lightsOn = session.setDevice(PowerDevice::LeftLight, true) &&
+                           session.setDevice(PowerDevice::RightLight, true);
+                lightsOffAt = time + policy.lightDuration;
+                nextLight = time + policy.lightInterval;
+                checkDoor(leftDoor, Room::WestDoor, time);
+                checkDoor(rightDoor, Room::EastDoor, time);
+            }
+
+            session.setDevice(PowerDevice::LeftDoor, leftDoor.closed);
+            session.setDevice(PowerDevice::RightDoor, rightDoor.closed);
+
+            session.step();
+        }
+
+    private:
+        struct Door {
+            bool closed = false;
+            float holdUntil = 0.0f;
+        };
+
+        void closeDoor(Door& door, float time) {
+            door.closed = true;
+            door.holdUntil = time + policy.doorHoldTime;
+        }
+
+        // Shut on a sighting; reopen only once the light shows the doorway empty
+        void checkDoor(Door& door, Room doorway, float time) {
+            if (session.isOccupied(doorway)) {
+                closeDoor(door, time);
+            } else if (time >= door.holdUntil) {
+                door.closed = false;
+            }
+        }
+
+        NightSession& session;
+        const CameraPolicy& policy;
+        bool cameraUp = false;
+        bool lightsOn = false;
+        float nextCamera = 0.0f;
+        float cameraDownAt = 0.0f;
+        float nextLight = 0.0f;
+        float lightsOffAt = 0.0f;
+        Door leftDoor;
+        Door rightDoor;
+        std::size_t cameraIndex = 0;
+    };
+}
+
+NightResult NightSimulator::runNight(const NightSettings& settings, const CameraPolicy& policy) {
+    NightSession session(settings);
+    PolicyDriver driver(session, policy);
+    while (session.getOutcome() == NightOutcome::Running) {
+        driver.step();
+    }
+
+    NightResult result;
+    result.seed = settings.seed;
+    result.outcome = session.getOutcome();
+    result.killer = session.getKiller();
+    result.time = session.getTime();
+    result.powerLeft = session.getPower();
+    result.powerOut = session.hadPowerOut();
+    result.doorBlocks = session.getDoorBlocks();
+    return result;
+}
+
+std::vector<NightResult> NightSimulator::runBatch(const NightSettings& settings, const CameraPolicy& policy,
+                                                  std::size_t nights, unsigned int threads) {
+    std::vector<NightResult> results(nights);
+    std::atomic<std::size_t> next(0);
+
+    auto worker = [&] {
+        NightSettings night = settings;
+        for (std::size_t i = next++; i < nights; i = next++) {
+            night.seed = settings.seed + static_cast<std::uint32_t>(i);
+            results[i] = runNight(night, policy);
+        }
+    };
+
+    threads = std::max(1u, std::min<unsigned int>(threads, static_cast<unsigned int>(std::max<std::size_t>(nights, 1))));
+    std::vector<std::thread> pool;
+    for (unsigned int t = 1; t < threads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return results;
+}
+
+SimulationSummary NightSimulator::summarize(const std::vector<NightResult>& results) {
+    SimulationSummary summary;
+    summary.nights = results.size();
+    double deathTime = 0.0;
+    double powerLeft = 0.0;
+    for (const auto& result : results) {
+        if (result.powerOut) {
+            ++summary.powerOuts;
+        }
+        if (result.outcome == NightOutcome::Survived) {
+            ++summary.survived;
+            powerLeft += result.powerLeft;
+        } else if (result.outcome == NightOutcome::Killed) {
+            ++summary.kills[static_cast<std::size_t>(result.killer)];
+            deathTime += result.time;
+        }
+    }
+    std::size_t lost = summary.nights - summary.survived;
+    summary.meanDeathTime = lost > 0 ? deathTime / static_cast<double>(lost) : 0.0;
+    summary.meanPowerLeft = summary.survived > 0 ? powerLeft / static_cast<double>(summary.survived) : 0.0;
+    return summary;
+}
+
+void NightSimulator::writeCsv(std::ostream& out, const std::vector<NightResult>& results) {
+    out << "seed,outcome,killer,time,power_left,power_out,door_blocks\n";
+    for (const auto& result : results) {
+        out << result.seed << ','
+            << toString(result.outcome) << ','
+            << (result.outcome == NightOutcome::Killed ? toString(result.killer) : "") << ','
+            << result.time << ','
+            << result.powerLeft << ','
+            << (result.powerOut ? 1 : 0) << ','
+            << result.doorBlocks << '\n';
+    }
+}
+
+void NightSimulator::writeJson(std::ostream& out, const NightSettings& settings, const CameraPolicy& policy,
+                               const SimulationSummary& summary) {
+    nlohmann::json report;
+    nlohmann::json levels;
+    nlohmann::json kills;
+    for (std::size_t k = 0; k < ANIMATRONIC_KIND_COUNT; ++k) {
+        const char* name = toString(static_cast<AnimatronicKind>(k));
+        levels[name] = settings.aiLevels[k];
+        kills[name] = summary.kills[k];
+    }
+
+    report["settings"] = {
+        { "seed", settings.seed },
+        { "night_length", settings.nightLength },
+        { "ai_levels", levels }
+    };
+    report["policy"] = {
+        { "camera_interval", policy.cameraInterval },
+        { "camera_duration", policy.cameraDuration },
+        { "light_interval", policy.lightInterval },
+        { "light_duration", policy.lightDuration },
+        { "door_hold_time", policy.doorHoldTime }
+    };
+    report["nights"] = summary.nights;
+    report["survived"] = summary.survived;
+    report["survival_rate"] = summary.nights > 0
+        ? static_cast<double>(summary.survived) / static_cast<double>(summary.nights) : 0.0;
+    report["power_outs"] = summary.powerOuts;
+    report["kills"] = kills;
+    report["mean_death_time"] = summary.meanDeathTime;
+    report["mean_power_left"] = summary.meanPowerLeft;
+    out << report.dump(2) << '\n';
+}
+
+const char* toString(AnimatronicKind kind) {
+    switch (kind) {
+        case AnimatronicKind::Freddy: return "freddy";
+        case AnimatronicKind::Bonnie: return "bonnie";
+        case AnimatronicKind::Chica:  return "chica";
+        case AnimatronicKind::Foxy:   return "foxy";
+        default:                      return "none";
+    }
+}
+
+const char* toString(NightOutcome outcome) {
+    switch (outcome) {
+        case NightOutcome::Survived: return "survived";
+        case NightOutcome::Killed:   return "killed";
+        default:                     return "running";
+    }
+}
+
+} // namespace Engine
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "NightSession.hpp"
+#include <iosfwd>
+#include <vector>
+
+namespace Engine {
+
+// Scripted stand-in for the player
+struct CameraPolicy {
+    float cameraInterval = 20.0f;    // Seconds between monitor checks
+    float cameraDuration = 2.5f;    // How long the monitor stays up
+    float lightInterval = 8.0f;     // Seconds between door light checks
+    float lightDuration = 0.5f;
+    float doorHoldTime = 4.0f;      // Door stays shut this long after a sighting
+};
+
+struct NightResult {
+    std::uint32_t seed = 0;
+    NightOutcome outcome = NightOutcome::Running;
+    AnimatronicKind killer = AnimatronicKind::Count;
+    float time = 0.0f;
+    float powerLeft = 0.0f;
+    bool powerOut = false;
+    std::uint32_t doorBlocks = 0;
+};
+
+struct SimulationSummary {
+    std::size_t nights = 0;
+    std::size_t survived = 0;
+    std::size_t powerOuts = 0;
+    std::array<std::size_t, ANIMATRONIC_KIND_COUNT> kills{};
+    double meanDeathTime = 0.0;       // Over nights that were lost
+    double meanPowerLeft = 0.0;       // Over nights that were survived
+};
+
+// Plays whole nights headless. Nights are independent, so a batch is split
+// across worker threads; night i uses seed baseSeed + i, which keeps results
+// identical whatever the thread count.
+class NightSimulator {
+public:
+    static NightResult runNight(const NightSettings& settings, const CameraPolicy& policy);
+
+    static std::vector<NightResult> runBatch(const NightSettings& settings, const CameraPolicy& policy,
+                                             std::size_t nights, unsigned int threads);
+
+    static SimulationSummary summarize(const std::vector<NightResult>& results);
+
+    static void writeCsv(std::ostream& out, const std::vector<NightResult>& results);
+    static void writeJson(std::ostream& out, const NightSettings& settings, const CameraPolicy& policy,
+                          const SimulationSummary& summary);
+};
+
+const char* toString(AnimatronicKind kind);
+const char* toString(NightOutcome outcome);
+
+} // namespace Engine
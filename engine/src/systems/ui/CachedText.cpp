@@ -0,0 +1,160 @@
+#include "CachedText.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace Engine {
+
+CachedText::CachedText()
+    : baseSize(20.0f)
+    , fillColor(sf::Color::White)
+    , anchor(Anchor::TopLeft)
+    , atlas(nullptr)
+    , epoch(0)
+    , geometryDirty(true)
+    , transformDirty(true)
+    , size(0.0f, 0.0f)
+{
+}
+
+CachedText::CachedText(const std::string& path, float baseCharacterSize)
+    : CachedText()
+{
+    fontPath = path;
+    baseSize = baseCharacterSize;
+}
+
+void CachedText::setFont(const std::string& path) {
+    if (path != fontPath) {
+        fontPath = path;
+        epoch = 0;
+    }
+}
+
+void CachedText::setBaseSize(float newSize) {
+    if (newSize != baseSize) {
+        baseSize = newSize;
+        epoch = 0;
+    }
+}
+
+void CachedText::setPosition(const sf::Vector2f& position, Anchor newAnchor) {
+    if (position != normalizedPosition || newAnchor != anchor) {
+        normalizedPosition = position;
+        anchor = newAnchor;
+        transformDirty = true;
+    }
+}
+
+void CachedText::setString(std::string_view newText) {
+    if (newText == text) {
+        return;
+    }
+    text.assign(newText.data(), newText.size());
+    geometryDirty = true;
+}
+
+void CachedText::setNumber(std::string_view prefix, long value, std::string_view suffix) {
+    char buffer[MAX_NUMBER_TEXT];
+    char* const end = buffer + sizeof(buffer);
+
+    std::size_t prefixLength = std::min(prefix.size(), sizeof(buffer) / 2);
+    std::memcpy(buffer, prefix.data(), prefixLength);
+    char* out = std::to_chars(buffer + prefixLength, end, value).ptr;
+    std::size_t suffixLength = std::min(suffix.size(), static_cast<std::size_t>(end - out));
+    std::memcpy(out, suffix.data(), suffixLength);
+    out += suffixLength;
+
+    setString(std::string_view(buffer, static_cast<std::size_t>(out - buffer)));
+}
+
+void CachedText::update() {
+    // A new render size means a new character size, and with it a new atlas
+    auto& scaling = ScalingManager::getInstance();
+    if (epoch != scaling.getEpoch()) {
+        epoch = scaling.getEpoch();
+        unsigned int characterSize = std::max(1u, static_cast<unsigned int>(std::lround(scaling.getScaledFontSize(baseSize))));
+        const GlyphAtlas* newAtlas = fontPath.empty() ? nullptr : GlyphAtlas::get(fontPath, characterSize);
+        if (newAtlas != atlas) {
+            atlas = newAtlas;
+            geometryDirty = true;
+        }
+        transformDirty = true;
+    }
+    if (geometryDirty) {
+        rebuildGeometry();
+        geometryDirty = false;
+        transformDirty = true;
+    }
+    if (transformDirty) {
+        sf::Vector2f anchorPoint = scaling.convertNormalizedToScreen(normalizedPosition.x, normalizedPosition.y);
+        sf::Vector2f offset = ScalingManager::getAnchorOffset(anchor);
+        transform = sf::Transform::Identity;
+        transform.translate(std::round(anchorPoint.x + offset.x * size.x), std::round(anchorPoint.y + offset.y * size.y));
+        transformDirty = false;
+    }
+}
+
+void CachedText::rebuildGeometry() {
+    quads.clear();
+    size = sf::Vector2f(0.0f, 0.0f);
+    if (!atlas) {
+        return;
+    }
+
+    // Same placement as sf::Text: the first baseline sits one character
+    // size below the top, glyph rects are padded by a texel
+    const float padding = 1.0f;
+    const float lineSpacing = atlas->getLineSpacing();
+    float x = 0.0f;
+    float y = static_cast<float>(atlas->getCharacterSize());
+    char previous = 0;
+    std::size_t lines = 1;
+    for (char c : text) {
+        if (c == '\n') {
+            size.x = std::max(size.x, x);
+            x = 0.0f;
+            y += lineSpacing;
+            previous = 0;
+            ++lines;
+            continue;
+        }
+        if (previous) {
+            x += atlas->getKerning(previous, c);
+        }
+        previous = c;
+
+        const GlyphAtlas::Glyph& glyph = atlas->getGlyph(c);
+        if (c != ' ' && glyph.textureRect.width > 0.0f) {
+            GlyphQuad quad;
+            quad.rect = sf::FloatRect(x + glyph.bounds.left - padding, y + glyph.bounds.top - padding,
+                                      glyph.bounds.width + 2.0f * padding, glyph.bounds.height + 2.0f * padding);
+            quad.textureRect = sf::FloatRect(glyph.textureRect.left - padding, glyph.textureRect.top - padding,
+                                             glyph.textureRect.width + 2.0f * padding, glyph.textureRect.height + 2.0f * padding);
+            quads.push_back(quad);
+        }
+        x += glyph.advance;
+    }
+    size.x = std::max(size.x, x);
+    size.y = lines * lineSpacing;
+}
+
+sf::Vector2f CachedText::getSize() {
+    update();
+    return size;
+}
+
+void CachedText::submit(RenderLayer layer) {
+    update();
+    if (quads.empty()) {
+        return;
+    }
+    auto& renderQueue = RenderQueue::getInstance();
+    const sf::Texture* texture = &atlas->getTexture();
+    for (const auto& quad : quads) {
+        renderQueue.submitQuad(texture, transform, quad.rect, quad.textureRect, fillColor, layer);
+    }
+}
+
+} // namespace Engine
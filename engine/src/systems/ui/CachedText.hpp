@@ -0,0 +1,68 @@
+#pragma once
+
+#include "GlyphAtlas.hpp"
+#include "ScalingManager.hpp"
+#include "../render/RenderQueue.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine {
+
+// Text for values that change while playing (FPS, night clock, power).
+// Glyph quads are built from a GlyphAtlas when the string or the scaled
+// character size changes and are only resubmitted otherwise; setting the
+// same string again is a comparison. Numbers are formatted on the stack,
+// so per-frame updates don't allocate once the string has its capacity.
+class CachedText {
+public:
+    CachedText();
+    explicit CachedText(const std::string& fontPath, float baseCharacterSize = 20.0f);
+
+    void setFont(const std::string& fontPath);
+    // Character size at 1280x720; follows the render size from there
+    void setBaseSize(float size);
+    void setColor(const sf::Color& color) { fillColor = color; }
+    // Where the anchor point of the text goes, as with ScalingManager::scaleSprite
+    void setPosition(const sf::Vector2f& normalizedPosition, Anchor anchor = Anchor::TopLeft);
+
+    void setString(std::string_view text);
+    // "<prefix><value><suffix>"
+    void setNumber(std::string_view prefix, long value, std::string_view suffix = {});
+    const std::string& getString() const { return text; }
+
+    // Size of the laid out text in render target pixels
+    sf::Vector2f getSize();
+
+    void submit(RenderLayer layer = RenderLayer::UI);
+
+private:
+    struct GlyphQuad {
+        sf::FloatRect rect;
+        sf::FloatRect textureRect;
+    };
+
+    void update();
+    void rebuildGeometry();
+
+    static constexpr std::size_t MAX_NUMBER_TEXT = 64;
+
+    std::string fontPath;
+    float baseSize;
+    sf::Color fillColor;
+    sf::Vector2f normalizedPosition;
+    Anchor anchor;
+    std::string text;
+
+    const GlyphAtlas* atlas;
+    std::uint64_t epoch;          // ScalingManager epoch the layout is for
+    bool geometryDirty;
+    bool transformDirty;
+    std::vector<GlyphQuad> quads;
+    sf::Vector2f size;
+    sf::Transform transform;
+};
+
+} // namespace Engine
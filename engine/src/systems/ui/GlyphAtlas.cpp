@@ -0,0 +1,61 @@
+#include "GlyphAtlas.hpp"
+#include "../../core/Logger.hpp"
+#include "../../resources/ResourceManager.hpp"
+#include <iostream>
+
+namespace Engine {
+
+const GlyphAtlas* GlyphAtlas::get(const std::string& fontPath, unsigned int characterSize) {
+    static std::map<std::string, std::unique_ptr<sf::Font>> fonts;
+    static std::map<std::pair<std::string, unsigned int>, std::unique_ptr<GlyphAtlas>> atlases;
+
+    auto key = std::make_pair(fontPath, characterSize);
+    auto it = atlases.find(key);
+    if (it != atlases.end()) {
+        return it->second.get();
+    }
+
+    auto& font = fonts[fontPath];
+    if (!font) {
+        auto loaded = std::make_unique<sf::Font>();
+        if (!ResourceManager::getInstance().loadFont(*loaded, fontPath)) {
+            std::cerr << "GlyphAtlas: Failed to load font: " << fontPath << std::endl;
+            fonts.erase(fontPath);
+            return nullptr;
+        }
+        font = std::move(loaded);
+    }
+
+    std::unique_ptr<GlyphAtlas> atlas(new GlyphAtlas(*font, characterSize));
+    TSS_LOG_DEBUG("GlyphAtlas", "Rasterized atlas", field("font", fontPath), field("size", characterSize));
+    return atlases.emplace(key, std::move(atlas)).first->second.get();
+}
+
+GlyphAtlas::GlyphAtlas(const sf::Font& font, unsigned int characterSize)
+    : font(font)
+    , characterSize(characterSize)
+    , lineSpacing(font.getLineSpacing(characterSize))
+{
+    for (char c = FIRST_CHAR; c <= LAST_CHAR; ++c) {
+        const sf::Glyph& glyph = font.getGlyph(static_cast<sf::Uint32>(c), characterSize, false);
+        Glyph& out = glyphs[c - FIRST_CHAR];
+        out.bounds = glyph.bounds;
+        out.textureRect = sf::FloatRect(glyph.textureRect);
+        out.advance = glyph.advance;
+    }
+    // Taken after rasterizing: the page may have grown meanwhile
+    texture = &font.getTexture(characterSize);
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::getGlyph(char c) const {
+    if (c < FIRST_CHAR || c > LAST_CHAR) {
+        c = '?';
+    }
+    return glyphs[c - FIRST_CHAR];
+}
+
+float GlyphAtlas::getKerning(char first, char second) const {
+    return font.getKerning(static_cast<sf::Uint32>(first), static_cast<sf::Uint32>(second), characterSize);
+}
+
+} // namespace Engine
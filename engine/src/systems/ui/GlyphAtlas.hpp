@@ -0,0 +1,47 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Engine {
+
+// Printable ASCII of one font at one character size, rasterized into the
+// font's glyph texture up front. Glyph metrics are copied out so laying out
+// text never goes through sf::Font's lookups, and nothing is rasterized
+// while a frame is being drawn.
+class GlyphAtlas {
+public:
+    struct Glyph {
+        sf::FloatRect bounds;         // Relative to the pen on the baseline
+        sf::FloatRect textureRect;
+        float advance = 0.0f;
+    };
+
+    // Atlases and fonts are created on first use and kept for the whole run;
+    // returns null if the font can't be loaded
+    static const GlyphAtlas* get(const std::string& fontPath, unsigned int characterSize);
+
+    const sf::Texture& getTexture() const { return *texture; }
+    // Characters outside the atlas are drawn as '?'
+    const Glyph& getGlyph(char c) const;
+    float getKerning(char first, char second) const;
+    float getLineSpacing() const { return lineSpacing; }
+    unsigned int getCharacterSize() const { return characterSize; }
+
+    static constexpr char FIRST_CHAR = ' ';
+    static constexpr char LAST_CHAR = '~';
+
+private:
+    GlyphAtlas(const sf::Font& font, unsigned int characterSize);
+
+    const sf::Font& font;
+    unsigned int characterSize;
+    float lineSpacing;
+    const sf::Texture* texture;   // The font's page for this size
+    Glyph glyphs[LAST_CHAR - FIRST_CHAR + 1];
+};
+
+} // namespace Engine
@@ -1,12 +1,19 @@
 #include "ScalingManager.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 namespace Engine {
 
 ScalingManager::ScalingManager()
     : currentWidth(BASE_WIDTH)
     , currentHeight(BASE_HEIGHT)
+    , windowWidth(BASE_WIDTH)
+    , windowHeight(BASE_HEIGHT)
+    , renderScale(1.0f)
     , scaleX(1.0f)
     , scaleY(1.0f)
+    , epoch(1)
 {
 }
 
@@ -16,6 +23,30 @@ ScalingManager& ScalingManager::getInstance() {
 }
 
 void ScalingManager::updateWindowSize(unsigned int width, unsigned int height) {
+    if (width == windowWidth && height == windowHeight) {
+        return;
+    }
+    windowWidth = width;
+    windowHeight = height;
+    updateRenderSize();
+}
+
+void ScalingManager::setRenderScale(float scale) {
+    scale = std::min(std::max(scale, 0.1f), 1.0f);
+    if (scale == renderScale) {
+        return;
+    }
+    renderScale = scale;
+    updateRenderSize();
+}
+
+void ScalingManager::updateRenderSize() {
+    unsigned int width = std::max(1u, static_cast<unsigned int>(std::lround(windowWidth * renderScale)));
+    unsigned int height = std::max(1u, static_cast<unsigned int>(std::lround(windowHeight * renderScale)));
+    if (width == currentWidth && height == currentHeight) {
+        return;
+    }
+    ++epoch;
     currentWidth = width;
     currentHeight = height;
     updateScaleFactors();
@@ -74,8 +105,8 @@ sf::Vector2f ScalingManager::convertNormalizedToScreen(float x, float y, Anchor
 }
 
 sf::Vector2f ScalingManager::convertScreenToNormalized(float x, float y) const {
-    float normalizedX = x / currentWidth;
-    float normalizedY = y / currentHeight;
+    float normalizedX = x / windowWidth;
+    float normalizedY = y / windowHeight;
     return sf::Vector2f(normalizedX, normalizedY);
 }
 
@@ -87,7 +118,7 @@ float ScalingManager::getScaledFontSize(float baseSize) const {
     return baseSize * std::min(scaleX, scaleY);
 }
 
-sf::Vector2f ScalingManager::getAnchorOffset(Anchor anchor) const {
+sf::Vector2f ScalingManager::getAnchorOffset(Anchor anchor) {
     switch (anchor) {
         case Anchor::TopLeft:
             return sf::Vector2f(0.0f, 0.0f);
@@ -123,33 +154,67 @@ void ScalingManager::scaleSprite(sf::Sprite& sprite, const sf::Vector2f& normali
 }
 
 void ScalingManager::scaleSpriteToFill(sf::Sprite& sprite) const {
-    const sf::Texture* texture = sprite.getTexture();
-    if (!texture) return;
+    if (!sprite.getTexture()) return;
 
-    sf::Vector2u textureSize = texture->getSize();
-    float scaleX = static_cast<float>(currentWidth) / static_cast<float>(textureSize.x);
-    float scaleY = static_cast<float>(currentHeight) / static_cast<float>(textureSize.y);
+    // Texture rect rather than texture size: YUV frames are packed into
+    // narrower plane textures but still span the full frame
+    sf::Vector2f frameSize = getRectSize(sprite);
+    float scaleX = static_cast<float>(currentWidth) / frameSize.x;
+    float scaleY = static_cast<float>(currentHeight) / frameSize.y;
     float scale = std::max(scaleX, scaleY); // Use max to ensure no black borders
 
-    sprite.setOrigin(textureSize.x / 2.f, textureSize.y / 2.f);
+    sprite.setOrigin(frameSize.x / 2.f, frameSize.y / 2.f);
     sprite.setScale(scale, scale);
     sprite.setPosition(currentWidth / 2.f, currentHeight / 2.f);
 }
 
 void ScalingManager::scaleSpriteWithAspectRatio(sf::Sprite& sprite, bool fillScreen) const {
-    const sf::Texture* texture = sprite.getTexture();
-    if (!texture) return;
+    if (!sprite.getTexture()) return;
 
-    sf::Vector2u textureSize = texture->getSize();
-    float scaleX = static_cast<float>(currentWidth) / static_cast<float>(textureSize.x);
-    float scaleY = static_cast<float>(currentHeight) / static_cast<float>(textureSize.y);
+    sf::Vector2f frameSize = getRectSize(sprite);
+    float scaleX = static_cast<float>(currentWidth) / frameSize.x;
+    float scaleY = static_cast<float>(currentHeight) / frameSize.y;
     float scale = fillScreen ? std::max(scaleX, scaleY) : std::min(scaleX, scaleY);
 
-    sprite.setOrigin(textureSize.x / 2.f, textureSize.y / 2.f);
+    sprite.setOrigin(frameSize.x / 2.f, frameSize.y / 2.f);
     sprite.setScale(scale, scale);
     sprite.setPosition(currentWidth / 2.f, currentHeight / 2.f);
 }
 
+sf::Vector2f ScalingManager::getRectSize(const sf::Sprite& sprite) {
+    sf::IntRect rect = sprite.getTextureRect();
+    return sf::Vector2f(static_cast<float>(std::abs(rect.width)), static_cast<float>(std::abs(rect.height)));
+}
+
+bool ScalingManager::isCacheValid(const sf::Sprite& sprite, const sf::Vector2f& position, Anchor anchor,
+                                  ScaleCache& cache) const {
+    sf::IntRect rect = sprite.getTextureRect();
+    sf::Vector2i rectSize = sprite.getTexture() ? sf::Vector2i(rect.width, rect.height) : sf::Vector2i(0, 0);
+    if (cache.epoch == epoch && cache.sprite == &sprite && cache.rectSize == rectSize &&
+        cache.position == position && cache.anchor == anchor) {
+        return true;
+    }
+    cache.epoch = epoch;
+    cache.sprite = &sprite;
+    cache.rectSize = rectSize;
+    cache.position = position;
+    cache.anchor = anchor;
+    return false;
+}
+
+void ScalingManager::scaleSprite(sf::Sprite& sprite, const sf::Vector2f& normalizedPosition, ScaleCache& cache,
+                                 Anchor anchor) const {
+    if (!isCacheValid(sprite, normalizedPosition, anchor, cache)) {
+        scaleSprite(sprite, normalizedPosition, anchor);
+    }
+}
+
+void ScalingManager::scaleSpriteToFill(sf::Sprite& sprite, ScaleCache& cache) const {
+    if (!isCacheValid(sprite, sf::Vector2f(), Anchor::TopLeft, cache)) {
+        scaleSpriteToFill(sprite);
+    }
+}
+
 Anchor ScalingManager::getAnchorFromString(const std::string& str) {
     if (str == "TopLeft") return Anchor::TopLeft;
     if (str == "TopCenter") return Anchor::TopCenter;
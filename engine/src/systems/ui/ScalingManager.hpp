@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <string>
 
 namespace Engine {
@@ -17,6 +18,17 @@ enum class Anchor {
     BottomRight
 };
 
+// Window epoch, sprite, texture rect size, position and anchor a transform
+// was last computed for. The cached scaling overloads skip the update while
+// all are unchanged.
+struct ScaleCache {
+    std::uint64_t epoch = 0;
+    const sf::Sprite* sprite = nullptr;
+    sf::Vector2i rectSize;
+    sf::Vector2f position;
+    Anchor anchor = Anchor::TopLeft;
+};
+
 class ScalingManager {
 public:
     static constexpr unsigned int BASE_WIDTH = 1280;
@@ -26,10 +38,24 @@ public:
     static Anchor getAnchorFromString(const std::string& str);
 
     void updateWindowSize(unsigned int width, unsigned int height);
+
+    // Frames are drawn into a render target of window size * scale (see
+    // RenderScaler); every layout function works in that target's pixels
+    void setRenderScale(float scale);
+    float getRenderScale() const { return renderScale; }
+    sf::Vector2u getRenderSize() const { return sf::Vector2u(currentWidth, currentHeight); }
+    sf::Vector2u getWindowSize() const { return sf::Vector2u(windowWidth, windowHeight); }
+
+    // Incremented whenever the render size actually changes
+    std::uint64_t getEpoch() const { return epoch; }
     sf::Vector2f convertNormalizedToScreen(float x, float y, Anchor anchor = Anchor::TopLeft) const;
+    // From window pixels (e.g. the mouse), so hitboxes stay exact at any
+    // render scale
     sf::Vector2f convertScreenToNormalized(float x, float y) const;
     sf::Vector2f getScaleFactors() const;
     float getScaledFontSize(float baseSize) const;
+    // Fraction of an element's size to shift it by so `anchor` is at its position
+    static sf::Vector2f getAnchorOffset(Anchor anchor);
 
     // Utility functions for converting between absolute and normalized coordinates
     static sf::Vector2f absoluteToNormalized(float x, float y) {
@@ -53,6 +79,11 @@ public:
     void scaleSpriteToFill(sf::Sprite& sprite) const;
     void scaleSpriteWithAspectRatio(sf::Sprite& sprite, bool fillScreen = false) const;
 
+    // Cached variants for per-frame draw code
+    void scaleSprite(sf::Sprite& sprite, const sf::Vector2f& normalizedPosition, ScaleCache& cache,
+                     Anchor anchor = Anchor::TopLeft) const;
+    void scaleSpriteToFill(sf::Sprite& sprite, ScaleCache& cache) const;
+
     // Delete copy constructor and assignment operator
     ScalingManager(const ScalingManager&) = delete;
     ScalingManager& operator=(const ScalingManager&) = delete;
@@ -60,13 +91,20 @@ public:
 private:
     ScalingManager(); // Private constructor for singleton
     
-    unsigned int currentWidth;
+    unsigned int currentWidth;      // Render target size
     unsigned int currentHeight;
+    unsigned int windowWidth;
+    unsigned int windowHeight;
+    float renderScale;
     float scaleX;
     float scaleY;
+    std::uint64_t epoch;
 
+    bool isCacheValid(const sf::Sprite& sprite, const sf::Vector2f& position, Anchor anchor,
+                      ScaleCache& cache) const;
+    static sf::Vector2f getRectSize(const sf::Sprite& sprite);
+    void updateRenderSize();
     void updateScaleFactors();
-    sf::Vector2f getAnchorOffset(Anchor anchor) const;
 };
 
 } // namespace Engine 
\ No newline at end of file
@@ -42,7 +42,7 @@ bool MenuHitbox::contains(const sf::Vector2f& normalizedPoint) const {
            screenTestPoint.y <= screenPos.y + screenSize.y;
 }
 
-void MenuHitbox::draw(sf::RenderWindow& window, bool debugMode, const std::string& currentState) const {
+void MenuHitbox::draw(Engine::RenderQueue& queue, bool debugMode, const std::string& currentState) const {
     // Only draw hitbox if we're in debug mode AND this hitbox belongs to the current state
     if (debugMode && state == currentState) {
         auto& scalingManager = Engine::ScalingManager::getInstance();
@@ -58,12 +58,6 @@ void MenuHitbox::draw(sf::RenderWindow& window, bool debugMode, const std::strin
             normalizedSize.y * Engine::ScalingManager::BASE_HEIGHT * scaleFactors.y
         );
         
-        // Update debug rectangle
-        sf::RectangleShape debugRect;
-        debugRect.setPosition(screenPos);
-        debugRect.setSize(screenSize);
-        debugRect.setFillColor(debugColor);
-        
-        window.draw(debugRect);
+        queue.submitRect(sf::FloatRect(screenPos, screenSize), debugColor, Engine::RenderLayer::Debug);
     }
 } 
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <functional>
 #include <string>
 #include "../systems/ui/ScalingManager.hpp"
+#include "../systems/render/RenderQueue.hpp"
 
 class MenuHitbox {
 public:
@@ -12,7 +13,7 @@ public:
                const std::string& state, Engine::Anchor anchor = Engine::Anchor::TopLeft);
     
     bool contains(const sf::Vector2f& normalizedPoint) const;
-    void draw(sf::RenderWindow& window, bool debugMode, const std::string& currentState) const;
+    void draw(Engine::RenderQueue& queue, bool debugMode, const std::string& currentState) const;
     
     const std::string& getName() const { return name; }
     const std::string& getState() const { return state; }
@@ -26,7 +27,6 @@ private:
     std::string name;
     std::string state;
     bool hasSelector;
-    mutable sf::RectangleShape debugRect;
     sf::Color debugColor;
     Engine::Anchor anchor;
 }; 
\ No newline at end of file
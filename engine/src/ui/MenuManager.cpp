@@ -1,18 +1,16 @@
 #include "MenuManager.hpp"
+#include "../systems/animation/AnimationManager.hpp"
 #include "../systems/ui/ScalingManager.hpp"
-#include <fstream>
+#include "../resources/ResourceManager.hpp"
 #include <nlohmann/json.hpp>
 #include <stdexcept>
 
 void MenuManager::loadFromJson(const std::string& filepath) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
+    nlohmann::json j;
+    if (!Engine::ResourceManager::getInstance().loadJson(j, filepath)) {
         throw std::runtime_error("Failed to open menu configuration file: " + filepath);
     }
 
-    nlohmann::json j;
-    file >> j;
-
     hitboxes.clear();
     for (const auto& button : j["button_hitboxes"]) {
         // Get position and size
@@ -50,6 +48,18 @@ void MenuManager::loadFromJson(const std::string& filepath) {
         
         hitboxes.emplace_back(position, size, button["name"].get<std::string>(), selectorPos, hasSelector, state, anchor);
     }
+
+    // Optional: which animations each button is likely to lead to
+    prefetchHints.clear();
+    if (j.contains("prefetch")) {
+        for (const auto& hint : j["prefetch"]) {
+            prefetchHints.push_back({
+                hint.value("state", "MainMenu"),
+                hint["button"].get<std::string>(),
+                hint["animations"].get<std::vector<std::string>>()
+            });
+        }
+    }
 }
 
 void MenuManager::handleInput(const sf::RenderWindow& window) {
@@ -60,6 +70,7 @@ void MenuManager::handleInput(const sf::RenderWindow& window) {
     sf::Vector2f worldPos = window.mapPixelToCoords(mousePos);
     sf::Vector2f normalizedPos = scalingManager.convertScreenToNormalized(worldPos.x, worldPos.y);
 
+    std::string previousButton = std::move(hoveredButton);
     hoveredButton.clear();
     for (const auto& hitbox : hitboxes) {
         // Only check hitboxes for the current state
@@ -72,16 +83,31 @@ void MenuManager::handleInput(const sf::RenderWindow& window) {
             break;
         }
     }
+
+    // A click usually follows a hover, so start decoding where it leads
+    if (!hoveredButton.empty() && hoveredButton != previousButton) {
+        prefetchForHover();
+    }
 }
 
-void MenuManager::draw(sf::RenderWindow& window) {
-    auto& scalingManager = Engine::ScalingManager::getInstance();
-    scalingManager.updateWindowSize(window.getSize().x, window.getSize().y);
+void MenuManager::prefetchForHover() const {
+    auto& animations = AnimationManager::getInstance();
+    for (const auto& hint : prefetchHints) {
+        if (hint.state == currentState && hint.button == hoveredButton) {
+            for (const auto& path : hint.animations) {
+                animations.prefetch(path);
+            }
+        }
+    }
+}
+
+void MenuManager::draw(sf::RenderTarget& target) {
+    auto& renderQueue = Engine::RenderQueue::getInstance();
 
     // Draw hitboxes in debug mode
     if (debugMode) {
         for (const auto& hitbox : hitboxes) {
-            hitbox.draw(window, true, currentState);
+            hitbox.draw(renderQueue, true, currentState);
         }
     }
 
@@ -92,7 +118,7 @@ void MenuManager::draw(sf::RenderWindow& window) {
             [this](const MenuHitbox& hitbox) { return hitbox.getName() == hoveredButton; });
      
         if (it != hitboxes.end() && it->getHasSelector()) {
-            window.draw(selectorSprite);
+            renderQueue.submit(selectorSprite, Engine::RenderLayer::UI);
         }
     }
 }
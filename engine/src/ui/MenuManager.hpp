@@ -6,6 +6,7 @@
 #include <string>
 #include "MenuHitbox.hpp"
 #include "../config/AssetPaths.hpp"
+#include "../resources/ResourceManager.hpp"
 
 class MenuManager {
 public:
@@ -16,7 +17,7 @@ public:
 
     void loadFromJson(const std::string& filepath);
     void handleInput(const sf::RenderWindow& window);
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& target);
     void toggleDebugMode() { debugMode = !debugMode; }
     bool isDebugMode() const { return debugMode; }
     const std::string& getHoveredButton() const { return hoveredButton; }
@@ -27,7 +28,7 @@ public:
 
 private:
     MenuManager() : debugMode(false), currentState("MainMenu") {
-        if (!selector.loadFromFile(AssetPaths::UI_SELECTOR)) {
+        if (!Engine::ResourceManager::getInstance().loadTexture(selector, AssetPaths::UI_SELECTOR)) {
             throw std::runtime_error("Failed to load selector texture");
         }
         selectorSprite.setTexture(selector);
@@ -35,7 +36,17 @@ private:
     MenuManager(const MenuManager&) = delete;
     MenuManager& operator=(const MenuManager&) = delete;
 
+    // Animations worth prefetching while a button is hovered
+    struct PrefetchHint {
+        std::string state;
+        std::string button;
+        std::vector<std::string> animations;
+    };
+
+    void prefetchForHover() const;
+
     std::vector<MenuHitbox> hitboxes;
+    std::vector<PrefetchHint> prefetchHints;
     bool debugMode;
     std::string hoveredButton;
     std::string currentState;
@@ -0,0 +1,306 @@
+// Packs engine/assets into a single assets.pak (see src/resources/AssetArchive.hpp).
+//
+//   AssetPacker <source-root> <output.pak>
+//
+// <source-root> is the directory that contains "assets"; logical paths in
+// the archive keep the "assets/" prefix so they match AssetPaths.
+//
+// Animation frames also get downscaled tiers (see AnimationTiers.hpp),
+// generated here so they never go stale against the source frames.
+
+#include "resources/AnimationTiers.hpp"
+#include "resources/AssetArchive.hpp"
+#include "resources/JpegDecoder.hpp"
+#include "resources/LzCodec.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <jpeglib.h>
+
+namespace fs = std::filesystem;
+using namespace Engine;
+
+namespace {
+    // Formats that are already compressed are stored as-is (and page aligned)
+    const std::set<std::string> COMPRESSIBLE_EXTENSIONS = {
+        ".json", ".ttf", ".otf", ".txt", ".csv", ".glsl", ".frag", ".vert"
+    };
+
+    // Only keep the compressed form if it saves at least this much
+    constexpr double MIN_COMPRESSION_RATIO = 0.9;
+
+    struct PackedEntry {
+        std::string path;
+        std::vector<char> stored;
+        std::uint64_t size = 0;
+        AssetArchive::Compression compression = AssetArchive::Compression::None;
+        bool generated = false;     // Contents already in `stored`, not on disk
+    };
+
+    bool readFile(const fs::path& path, std::vector<char>& out) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    // Baseline JPEG with libjpeg's default 4:2:0 sampling, so tiers keep the
+    // YUV decode path
+    std::vector<char> encodeJpeg(const RgbaImage& image, int quality) {
+        jpeg_compress_struct info;
+        jpeg_error_mgr errors;
+        info.err = jpeg_std_error(&errors);   // Errors abort the pack
+        jpeg_create_compress(&info);
+
+        unsigned char* buffer = nullptr;
+        unsigned long size = 0;
+        jpeg_mem_dest(&info, &buffer, &size);
+
+        info.image_width = image.width;
+        info.image_height = image.height;
+        info.input_components = 4;
+        info.in_color_space = JCS_EXT_RGBA;
+        jpeg_set_defaults(&info);
+        jpeg_set_quality(&info, quality, TRUE);
+        jpeg_start_compress(&info, TRUE);
+        while (info.next_scanline < info.image_height) {
+            JSAMPROW row = const_cast<JSAMPROW>(image.pixels.data() +
+                static_cast<std::size_t>(info.next_scanline) * image.width * 4);
+            jpeg_write_scanlines(&info, &row, 1);
+        }
+        jpeg_finish_compress(&info);
+        jpeg_destroy_compress(&info);
+
+        std::vector<char> out(buffer, buffer + size);
+        std::free(buffer);
+        return out;
+    }
+
+    // Frames directly inside an animation directory (not already a tier)
+    bool isAnimationFrame(const std::string& path) {
+        const std::string prefix = AnimationTiers::ANIMATIONS_PREFIX;
+        if (path.compare(0, prefix.size(), prefix) != 0 || fs::path(path).extension() != ".jpg") {
+            return false;
+        }
+        return std::count(path.begin() + prefix.size(), path.end(), '/') == 1;
+    }
+
+    // Adds the tier copies of every animation frame to `entries`. Tiers
+    // that exist on disk are packed as they are instead.
+    bool generateTiers(const fs::path& sourceRoot, std::vector<PackedEntry>& entries) {
+        std::set<std::string> existing;
+        std::vector<std::string> frames;
+        for (const auto& entry : entries) {
+            existing.insert(entry.path);
+            if (isAnimationFrame(entry.path)) {
+                frames.push_back(entry.path);
+            }
+        }
+
+        struct TierJob {
+            std::string source;
+            unsigned int denominator;
+        };
+        std::vector<PackedEntry> tiers;
+        std::vector<TierJob> jobs;
+        for (const auto& frame : frames) {
+            fs::path logical(frame);
+            for (unsigned int denominator : AnimationTiers::DENOMINATORS) {
+                PackedEntry tier;
+                tier.path = AnimationTiers::directoryFor(logical.parent_path().generic_string(), denominator) +
+                            "/" + logical.filename().generic_string();
+                if (!existing.count(tier.path)) {
+                    tier.generated = true;
+                    tiers.push_back(std::move(tier));
+                    jobs.push_back({ frame, denominator });
+                }
+            }
+        }
+
+        // Decode + encode dominates packing time; spread it over all cores
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        auto worker = [&] {
+            std::vector<char> source;
+            RgbaImage image;
+            for (std::size_t i = next++; i < jobs.size() && !failed; i = next++) {
+                const TierJob& job = jobs[i];
+                if (!readFile(sourceRoot / job.source, source) ||
+                    !JpegDecoder::decodeRgba(source.data(), source.size(), image, job.denominator)) {
+                    std::cerr << "AssetPacker: Failed to decode " << job.source << std::endl;
+                    failed = true;
+                    return;
+                }
+                tiers[i].stored = encodeJpeg(image, AnimationTiers::JPEG_QUALITY);
+            }
+        };
+        unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            threads.emplace_back(worker);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (failed) {
+            return false;
+        }
+
+        std::cout << "AssetPacker: Generated " << tiers.size() << " animation tier frames" << std::endl;
+        std::move(tiers.begin(), tiers.end(), std::back_inserter(entries));
+        return true;
+    }
+
+    void writePadding(std::ofstream& out, std::uint64_t& position, std::uint64_t alignment) {
+        std::uint64_t aligned = AssetArchive::alignUp(position, alignment);
+        static const char zeros[AssetArchive::ENTRY_ALIGNMENT] = {};
+        out.write(zeros, static_cast<std::streamsize>(aligned - position));
+        position = aligned;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <source-root> <output.pak>" << std::endl;
+        return 1;
+    }
+
+    const fs::path sourceRoot = argv[1];
+    const fs::path outputPath = argv[2];
+    const fs::path assetsDir = sourceRoot / "assets";
+
+    if (!fs::is_directory(assetsDir)) {
+        std::cerr << "AssetPacker: Not a directory: " << assetsDir << std::endl;
+        return 1;
+    }
+
+    // Gather files; the TOC must be sorted by logical path for binary search
+    std::vector<PackedEntry> entries;
+    for (const auto& item : fs::recursive_directory_iterator(assetsDir)) {
+        if (!item.is_regular_file()) continue;
+        PackedEntry entry;
+        entry.path = fs::relative(item.path(), sourceRoot).generic_string();
+        entries.push_back(std::move(entry));
+    }
+    if (!generateTiers(sourceRoot, entries)) {
+        return 1;
+    }
+    std::sort(entries.begin(), entries.end(),
+        [](const PackedEntry& a, const PackedEntry& b) { return a.path < b.path; });
+
+    std::uint64_t rawBytes = 0;
+    std::uint64_t storedBytes = 0;
+    std::size_t compressedCount = 0;
+
+    for (auto& entry : entries) {
+        std::vector<char> raw;
+        if (entry.generated) {
+            raw = std::move(entry.stored);
+        } else if (!readFile(sourceRoot / entry.path, raw)) {
+            std::cerr << "AssetPacker: Failed to read " << entry.path << std::endl;
+            return 1;
+        }
+        if (entry.path.size() > UINT16_MAX) {
+            std::cerr << "AssetPacker: Path too long: " << entry.path << std::endl;
+            return 1;
+        }
+        entry.size = raw.size();
+        rawBytes += raw.size();
+
+        // Per-entry compression choice
+        std::string extension = fs::path(entry.path).extension().string();
+        if (COMPRESSIBLE_EXTENSIONS.count(extension) && !raw.empty()) {
+            std::vector<char> packed = LzCodec::compress(raw.data(), raw.size());
+            if (packed.size() < raw.size() * MIN_COMPRESSION_RATIO) {
+                entry.stored = std::move(packed);
+                entry.compression = AssetArchive::Compression::Lz;
+                ++compressedCount;
+            }
+        }
+        if (entry.compression == AssetArchive::Compression::None) {
+            entry.stored = std::move(raw);
+        }
+        storedBytes += entry.stored.size();
+    }
+
+    // Write to a temporary file so a failed pack never leaves a truncated archive
+    fs::path tempPath = outputPath;
+    tempPath += ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "AssetPacker: Failed to open " << tempPath << std::endl;
+        return 1;
+    }
+
+    AssetArchive::Header header = {};
+    std::copy(std::begin(AssetArchive::MAGIC), std::end(AssetArchive::MAGIC), header.magic);
+    header.version = AssetArchive::VERSION;
+    header.entryCount = static_cast<std::uint32_t>(entries.size());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::uint64_t position = sizeof(header);
+
+    std::vector<AssetArchive::TocEntry> toc;
+    std::string strings;
+    toc.reserve(entries.size());
+
+    for (const auto& entry : entries) {
+        // Uncompressed entries are page aligned so they can be used in place
+        bool raw = entry.compression == AssetArchive::Compression::None;
+        writePadding(out, position, raw ? AssetArchive::ENTRY_ALIGNMENT : 8);
+
+        AssetArchive::TocEntry tocEntry = {};
+        tocEntry.offset = position;
+        tocEntry.storedSize = entry.stored.size();
+        tocEntry.size = entry.size;
+        tocEntry.pathOffset = static_cast<std::uint32_t>(strings.size());
+        tocEntry.pathLength = static_cast<std::uint16_t>(entry.path.size());
+        tocEntry.compression = static_cast<std::uint8_t>(entry.compression);
+        toc.push_back(tocEntry);
+        strings += entry.path;
+
+        out.write(entry.stored.data(), static_cast<std::streamsize>(entry.stored.size()));
+        position += entry.stored.size();
+    }
+
+    writePadding(out, position, alignof(AssetArchive::TocEntry));
+    header.tocOffset = position;
+    out.write(reinterpret_cast<const char*>(toc.data()),
+              static_cast<std::streamsize>(toc.size() * sizeof(AssetArchive::TocEntry)));
+    position += toc.size() * sizeof(AssetArchive::TocEntry);
+
+    header.stringsOffset = position;
+    header.stringsSize = strings.size();
+    out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (!out) {
+        std::cerr << "AssetPacker: Failed to write " << tempPath << std::endl;
+        return 1;
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, outputPath, ec);
+    if (ec) {
+        std::cerr << "AssetPacker: Failed to move archive into place: " << ec.message() << std::endl;
+        return 1;
+    }
+
+    std::cout << "AssetPacker: Packed " << entries.size() << " files ("
+              << compressedCount << " compressed), "
+              << rawBytes / 1024 << " KiB -> " << storedBytes / 1024 << " KiB into "
+              << outputPath.string() << std::endl;
+    return 0;
+}
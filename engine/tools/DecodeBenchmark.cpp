@@ -0,0 +1,178 @@
+// Compares animation frame decode paths on the frames of one animation.
+//
+//   DecodeBenchmark [animation-dir] [max-frames]
+//
+// Baseline is sf::Texture::loadFromMemory (what sf::Texture::loadFromFile
+// does after reading the file: stb_image decode + upload). The other rows
+// decode with libjpeg-turbo at each DCT scale, to RGBA and to YUV 4:2:0
+// planes, then upload. When the assets are packed, the last rows decode the
+// animation's resolution tiers at full size, for comparison with the DCT
+// rows of the same output size. Reads assets through the VFS like the game,
+// so run it from the build directory.
+
+#include "config/AssetPaths.hpp"
+#include "resources/AnimationTiers.hpp"
+#include "resources/JpegDecoder.hpp"
+#include "resources/VirtualFileSystem.hpp"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        double decodeMs = 0.0;
+        double uploadMs = 0.0;
+        std::size_t bytes = 0;
+        std::size_t frames = 0;
+    };
+
+    double elapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void uploadPlane(sf::Texture& texture, const std::vector<std::uint8_t>& plane,
+                     unsigned int stride, unsigned int rows) {
+        // 4 samples per RGBA texel, as Animation stores them
+        if (texture.getSize() != sf::Vector2u(stride / 4, rows)) {
+            texture.create(stride / 4, rows);
+        }
+        texture.update(plane.data());
+    }
+
+    std::vector<AssetFile> openFrames(const std::string& directory, std::size_t maxFrames) {
+        auto& vfs = VirtualFileSystem::getInstance();
+        std::vector<std::string> paths = vfs.list(directory, ".jpg");
+        if (paths.size() > maxFrames) {
+            paths.resize(maxFrames);
+        }
+        // Keep every frame mapped so file access is not part of the timings
+        std::vector<AssetFile> files;
+        for (const auto& path : paths) {
+            files.push_back(vfs.open(path));
+        }
+        return files;
+    }
+
+    Result benchmarkRgba(const std::vector<AssetFile>& files, unsigned int scale) {
+        Result rgba;
+        sf::Texture texture;
+        RgbaImage image;
+        for (const auto& file : files) {
+            auto start = Clock::now();
+            if (!JpegDecoder::decodeRgba(file.data(), file.size(), image, scale)) continue;
+            rgba.decodeMs += elapsedMs(start);
+
+            start = Clock::now();
+            if (texture.getSize() != sf::Vector2u(image.width, image.height)) {
+                texture.create(image.width, image.height);
+            }
+            texture.update(image.pixels.data());
+            rgba.uploadMs += elapsedMs(start);
+            rgba.bytes += image.pixels.size();
+            ++rgba.frames;
+        }
+        return rgba;
+    }
+
+    Result benchmarkYuv(const std::vector<AssetFile>& files, unsigned int scale) {
+        Result yuv;
+        sf::Texture luma, chromaB, chromaR;
+        YuvImage image;
+        for (const auto& file : files) {
+            auto start = Clock::now();
+            if (!JpegDecoder::decodeYuv420(file.data(), file.size(), image, scale)) continue;
+            yuv.decodeMs += elapsedMs(start);
+
+            start = Clock::now();
+            uploadPlane(luma, image.luma, image.lumaStride, image.height);
+            uploadPlane(chromaB, image.chromaB, image.chromaStride, image.chromaHeight);
+            uploadPlane(chromaR, image.chromaR, image.chromaStride, image.chromaHeight);
+            yuv.uploadMs += elapsedMs(start);
+            yuv.bytes += static_cast<std::size_t>(image.lumaStride) * image.height +
+                         static_cast<std::size_t>(image.chromaStride) * image.chromaHeight * 2;
+            ++yuv.frames;
+        }
+        return yuv;
+    }
+
+    void printRow(const std::string& name, const Result& result, const Result& baseline) {
+        if (result.frames == 0) {
+            std::printf("%-28s failed\n", name.c_str());
+            return;
+        }
+        double frames = static_cast<double>(result.frames);
+        double total = (result.decodeMs + result.uploadMs) / frames;
+        double baselineTotal = (baseline.decodeMs + baseline.uploadMs) / static_cast<double>(baseline.frames);
+        std::printf("%-28s %8.2f %8.2f %8.2f %8.0f %7.2fx\n",
+                    name.c_str(),
+                    result.decodeMs / frames,
+                    result.uploadMs / frames,
+                    total,
+                    static_cast<double>(result.bytes) / frames / 1024.0,
+                    baselineTotal / total);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string directory = argc > 1 ? argv[1] : AssetPaths::MAIN_MENU_ANIM;
+    std::size_t maxFrames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 120;
+
+    std::vector<AssetFile> files = openFrames(directory, maxFrames);
+    if (files.empty()) {
+        std::cerr << "DecodeBenchmark: No frames in " << directory << std::endl;
+        return 1;
+    }
+
+    // Texture uploads need a context; no window is opened
+    sf::Context context;
+
+    Result baseline;
+    {
+        sf::Texture texture;
+        for (const auto& file : files) {
+            auto start = Clock::now();
+            if (!texture.loadFromMemory(file.data(), file.size())) continue;
+            baseline.decodeMs += elapsedMs(start);
+            baseline.bytes += static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+            ++baseline.frames;
+        }
+    }
+    if (baseline.frames == 0) {
+        std::cerr << "DecodeBenchmark: Baseline decode failed" << std::endl;
+        return 1;
+    }
+
+    std::printf("%zu frames from %s\n\n", files.size(), directory.c_str());
+    std::printf("%-28s %8s %8s %8s %8s %8s\n", "path (ms/frame)", "decode", "upload", "total", "KiB", "speedup");
+    // loadFromMemory decodes and uploads in one call
+    printRow("sf::Texture::loadFromMemory", baseline, baseline);
+
+    for (unsigned int scale : { 1u, 2u, 4u, 8u }) {
+        printRow("turbo RGBA 1/" + std::to_string(scale), benchmarkRgba(files, scale), baseline);
+    }
+
+    for (unsigned int scale : { 1u, 2u, 4u, 8u }) {
+        printRow("turbo YUV 4:2:0 1/" + std::to_string(scale), benchmarkYuv(files, scale), baseline);
+    }
+
+    // Pre-scaled tiers, decoded at full size
+    for (unsigned int denominator : AnimationTiers::DENOMINATORS) {
+        std::vector<AssetFile> tierFiles = openFrames(AnimationTiers::directoryFor(directory, denominator), maxFrames);
+        if (tierFiles.empty()) {
+            continue;
+        }
+        std::string tier = "tier 1/" + std::to_string(denominator);
+        printRow(tier + " RGBA", benchmarkRgba(tierFiles, 1), baseline);
+        printRow(tier + " YUV 4:2:0", benchmarkYuv(tierFiles, 1), baseline);
+    }
+
+    return 0;
+}
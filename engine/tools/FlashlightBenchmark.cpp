@@ -0,0 +1,116 @@
+// Times FlashlightSystem per frame at 720p, 1080p and 4K.
+//
+//   FlashlightBenchmark [frames]
+//
+// The window size is set through ScalingManager, as a resize would. Each
+// frame renders the light buffer with 1, 4 and 16 lights, multiplies it over
+// a scene-sized render texture via the RenderQueue and waits on glFinish.
+// The baseline column is the naive approach for one light: a per-pixel
+// mask computed on the CPU at full resolution and uploaded every frame.
+
+#include "systems/camera_systems/FlashlightSystem.hpp"
+#include "systems/render/RenderQueue.hpp"
+#include "systems/ui/ScalingManager.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    double naiveMaskFrame(std::vector<sf::Uint8>& pixels, sf::Texture& mask, sf::Vector2u size, float radius) {
+        auto start = Clock::now();
+        float cx = static_cast<float>(size.x) / 2.0f;
+        float cy = static_cast<float>(size.y) / 2.0f;
+        for (unsigned int y = 0; y < size.y; ++y) {
+            for (unsigned int x = 0; x < size.x; ++x) {
+                float dx = static_cast<float>(x) - cx;
+                float dy = static_cast<float>(y) - cy;
+                float t = std::max(0.0f, 1.0f - std::sqrt(dx * dx + dy * dy) / radius);
+                auto value = static_cast<sf::Uint8>(255.0f * t * t * (3.0f - 2.0f * t));
+                sf::Uint8* pixel = &pixels[(static_cast<std::size_t>(y) * size.x + x) * 4];
+                pixel[0] = pixel[1] = pixel[2] = value;
+                pixel[3] = 255;
+            }
+        }
+        mask.update(pixels.data());
+        glFinish();
+        return elapsedMs(start);
+    }
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 60;
+    if (frames <= 0) {
+        std::fprintf(stderr, "usage: FlashlightBenchmark [frames]\n");
+        return 1;
+    }
+
+    sf::Context context;
+    std::printf("renderer: %s\n\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-10s %10s %10s %10s %10s %12s\n", "window", "buffer", "1 light", "4 lights", "16 lights", "naive mask");
+
+    auto& scaling = ScalingManager::getInstance();
+    auto& lighting = FlashlightSystem::getInstance();
+    auto& queue = RenderQueue::getInstance();
+
+    const sf::Vector2u sizes[] = { { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& size : sizes) {
+        scaling.updateWindowSize(size.x, size.y);
+        sf::RenderTexture scene;
+        if (!scene.create(size.x, size.y)) {
+            std::fprintf(stderr, "FlashlightBenchmark: Failed to create %ux%u scene\n", size.x, size.y);
+            return 1;
+        }
+
+        double perLightCount[3] = {};
+        const int lightCounts[3] = { 1, 4, 16 };
+        for (int c = 0; c < 3; ++c) {
+            lighting.setFlashlight(true);
+            double total = 0.0;
+            for (int frame = 0; frame < frames; ++frame) {
+                auto start = Clock::now();
+                lighting.clearLights();
+                lighting.setFlashlightPosition(sf::Vector2f(0.5f + 0.3f * std::sin(frame * 0.1f), 0.5f));
+                for (int i = 1; i < lightCounts[c]; ++i) {
+                    lighting.addLight({ sf::Vector2f(static_cast<float>(i) / lightCounts[c], 0.3f), 120.0f,
+                                        sf::Color(255, 200, 150) });
+                }
+                lighting.render();
+                queue.submitRect(sf::FloatRect(0.0f, 0.0f, static_cast<float>(size.x), static_cast<float>(size.y)),
+                                 sf::Color(90, 90, 90), RenderLayer::Scene);
+                lighting.submit();
+                queue.flush(scene);
+                scene.display();
+                glFinish();
+                total += elapsedMs(start);
+            }
+            perLightCount[c] = total / frames;
+        }
+
+        sf::Texture mask;
+        mask.create(size.x, size.y);
+        std::vector<sf::Uint8> pixels(static_cast<std::size_t>(size.x) * size.y * 4);
+        double naive = 0.0;
+        int naiveFrames = std::max(1, frames / 4);
+        for (int frame = 0; frame < naiveFrames; ++frame) {
+            naive += naiveMaskFrame(pixels, mask, size, 220.0f * static_cast<float>(size.y) / 720.0f);
+        }
+
+        sf::Vector2u buffer = lighting.getBufferSize();
+        std::printf("%4ux%-5u %4ux%-5u %10.3f %10.3f %10.3f %12.3f\n",
+                    size.x, size.y, buffer.x, buffer.y,
+                    perLightCount[0], perLightCount[1], perLightCount[2], naive / naiveFrames);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Headless night simulator for difficulty balancing.
+//
+//   NightSim [--nights N] [--threads T] [--seed S] [--levels F,B,C,X]
+//            [--length SECONDS] [--camera-interval S] [--camera-duration S]
+//            [--light-interval S] [--door-hold S] [--csv FILE] [--json FILE]
+//
+// Plays N seeded nights with the scripted camera policy on all cores and
+// prints a JSON summary. --csv writes one row per night, --json writes the
+// summary to a file instead of stdout. Levels are Freddy, Bonnie, Chica, Foxy.
+
+#include "systems/simulation/NightSimulator.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace Engine;
+
+namespace {
+    void printUsage() {
+        std::cerr << "usage: NightSim [--nights N] [--threads T] [--seed S] [--levels F,B,C,X]\n"
+                     "                [--length SECONDS] [--camera-interval S] [--camera-duration S]\n"
+                     "                [--light-interval S] [--door-hold S] [--csv FILE] [--json FILE]" << std::endl;
+    }
+
+    bool parseLevels(const std::string& text, NightSettings& settings) {
+        std::stringstream stream(text);
+        std::string item;
+        std::size_t k = 0;
+        while (std::getline(stream, item, ',')) {
+            if (k >= ANIMATRONIC_KIND_COUNT) return false;
+            settings.aiLevels[k++] = std::atoi(item.c_str());
+        }
+        return k == ANIMATRONIC_KIND_COUNT;
+    }
+}
+
+int main(int argc, char** argv) {
+    NightSettings settings;
+    settings.aiLevels = { 0, 3, 1, 1 };
+    CameraPolicy policy;
+    std::size_t nights = 10000;
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string csvPath;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (option == "--nights") nights = std::strtoul(value, nullptr, 10);
+        else if (option == "--threads") threads = static_cast<unsigned int>(std::strtoul(value, nullptr, 10));
+        else if (option == "--seed") settings.seed = static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (option == "--length") settings.nightLength = std::strtof(value, nullptr);
+        else if (option == "--camera-interval") policy.cameraInterval = std::strtof(value, nullptr);
+        else if (option == "--camera-duration") policy.cameraDuration = std::strtof(value, nullptr);
+        else if (option == "--light-interval") policy.lightInterval = std::strtof(value, nullptr);
+        else if (option == "--door-hold") policy.doorHoldTime = std::strtof(value, nullptr);
+        else if (option == "--csv") csvPath = value;
+        else if (option == "--json") jsonPath = value;
+        else if (option == "--levels") {
+            if (!parseLevels(value, settings)) {
+                std::cerr << "NightSim: --levels needs four comma-separated values" << std::endl;
+                return 1;
+            }
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto results = NightSimulator::runBatch(settings, policy, nights, threads);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto summary = NightSimulator::summarize(results);
+
+    if (!csvPath.empty()) {
+        std::ofstream csv(csvPath);
+        if (!csv) {
+            std::cerr << "NightSim: Cannot write " << csvPath << std::endl;
+            return 1;
+        }
+        NightSimulator::writeCsv(csv, results);
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream json(jsonPath);
+        if (!json) {
+            std::cerr << "NightSim: Cannot write " << jsonPath << std::endl;
+            return 1;
+        }
+        NightSimulator::writeJson(json, settings, policy, summary);
+    } else {
+        NightSimulator::writeJson(std::cout, settings, policy, summary);
+    }
+
+    std::cerr << nights << " nights on " << threads << " threads in " << seconds << " s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,119 @@
+// Times the two StaticNoise backends per frame.
+//
+//   NoiseBenchmark [frames]
+//
+// For 720p and 1080p targets and noise cells of 1, 2 and 4 pixels: the CPU
+// fill (SSE2 kernel and a scalar reference), the texture upload, and the
+// draw into a render texture of the target size for both the CPU texture
+// and the noise shader. glFinish is called after every draw so the GPU (or
+// llvmpipe) time is included. Run with LIBGL_ALWAYS_SOFTWARE=1 to measure
+// Mesa's software rasterizer like CI does.
+
+#include "systems/camera_systems/StaticNoise.hpp"
+#include "systems/render/RenderQueue.hpp"
+#include "systems/render/TextureStreamer.hpp"
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Engine;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void fillScalar(std::uint32_t* pixels, std::size_t count, std::uint32_t& state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            pixels[i] = (state & 0xFFu) * 0x010101u | 0xFF000000u;
+        }
+    }
+
+    // Draws what the RenderQueue would for one noise quad and waits for it
+    double drawFrame(StaticNoise& noise, sf::RenderTexture& target) {
+        auto start = Clock::now();
+        noise.update();
+        noise.submit(sf::FloatRect(0.0f, 0.0f, static_cast<float>(target.getSize().x),
+                                   static_cast<float>(target.getSize().y)));
+        RenderQueue::getInstance().flush(target);
+        target.display();
+        glFinish();
+        return elapsedMs(start);
+    }
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 120;
+    if (frames <= 0) {
+        std::fprintf(stderr, "usage: NoiseBenchmark [frames]\n");
+        return 1;
+    }
+
+    sf::Context context;
+    std::printf("renderer: %s\n\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+    std::printf("%-10s %5s %10s %10s %10s %10s %10s\n",
+                "target", "cell", "fill SSE", "fill ref", "upload", "CPU frame", "shader");
+
+    const sf::Vector2u targets[] = { { 1280, 720 }, { 1920, 1080 } };
+    for (const auto& size : targets) {
+        sf::RenderTexture target;
+        if (!target.create(size.x, size.y)) {
+            std::fprintf(stderr, "NoiseBenchmark: Failed to create %ux%u target\n", size.x, size.y);
+            return 1;
+        }
+
+        for (unsigned int divisor : { 1u, 2u, 4u }) {
+            StaticNoise noise;
+            noise.setResolution(size.x, size.y, divisor);
+            noise.setIntensity(1.0f);
+            sf::Vector2u cells = noise.getCellCount();
+            std::vector<std::uint32_t> pixels(static_cast<std::size_t>(cells.x) * cells.y);
+
+            std::uint32_t state[4] = { 1u, 2u, 3u, 4u };
+            auto start = Clock::now();
+            for (int i = 0; i < frames; ++i) StaticNoise::fill(pixels.data(), pixels.size(), state);
+            double fillMs = elapsedMs(start) / frames;
+
+            std::uint32_t scalarState = 1u;
+            start = Clock::now();
+            for (int i = 0; i < frames; ++i) fillScalar(pixels.data(), pixels.size(), scalarState);
+            double scalarMs = elapsedMs(start) / frames;
+
+            sf::Texture texture;
+            texture.create(cells.x, cells.y);
+            start = Clock::now();
+            for (int i = 0; i < frames; ++i) {
+                TextureStreamer::getInstance().upload(texture, reinterpret_cast<const sf::Uint8*>(pixels.data()),
+                                                      cells.x, cells.y);
+            }
+            glFinish();
+            double uploadMs = elapsedMs(start) / frames;
+
+            double cpuMs = 0.0;
+            noise.setBackend(NoiseBackend::Cpu);
+            for (int i = 0; i < frames; ++i) cpuMs += drawFrame(noise, target);
+
+            double shaderMs = 0.0;
+            noise.setBackend(NoiseBackend::Shader);
+            for (int i = 0; i < frames; ++i) shaderMs += drawFrame(noise, target);
+            bool shaderRan = noise.getBackend() == NoiseBackend::Shader;
+
+            std::printf("%4ux%-5u %5u %10.3f %10.3f %10.3f %10.3f ",
+                        size.x, size.y, divisor, fillMs, scalarMs, uploadMs, cpuMs / frames);
+            if (shaderRan) {
+                std::printf("%10.3f\n", shaderMs / frames);
+            } else {
+                std::printf("%10s\n", "n/a");
+            }
+        }
+    }
+    return 0;
+}